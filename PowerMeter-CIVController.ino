@@ -19,6 +19,8 @@ No publication without acknowledgement to author
 // comment following line for Basic SWR/Power Metet.  Uncomment for + C-IV control
 #define		CIV										// build with CIV functions
 //#define		TEENSY40								// comment this line for default = Teensy 3.2
+#define		FAST_MATH								// table based dBm, return loss, swr. comment for float maths
+//#define		FRAME_BUFFER							// Teensy 4.0 only, draw to RAM, DMA to tft. comment for direct drawing
 
 //#define		TOUCH_REVERSED false 					// touchscreen, true = reversed, false = normal
 //#define     SCREEN_ROTATION 3						// rotation for tft and touchscreen
@@ -26,7 +28,11 @@ No publication without acknowledgement to author
 #define     SCREEN_ROTATION 1						// rotation for tft and touchscreen
 
 #include <SPI.h>
+#ifdef FRAME_BUFFER
+#include <ILI9341_t3n.h>								// frame buffer + async DMA, fonts from ILI9341_fonts library
+#else
 #include <ILI9341_t3.h>
+#endif
 #include <XPT2046_Touchscreen.h>
 #include <ADC.h>
 #include <EEPROM.h>
@@ -77,6 +83,11 @@ void setup()
 
 	tft.begin();										// TFT begin
 	tft.setRotation(SCREEN_ROTATION);					// horizontal, pins to right. Cursor 0,0 = TOP LEFT of screen
+#ifdef FRAME_BUFFER
+	tft.setFrameBuffer(tftBuff[0]);						// draw to RAM, see updateDisplay()
+	tft.useFrameBuffer(true);
+	tft.updateChangedAreasOnly(true);					// drawn area tracked, see updateDisplay()
+#endif
 
 	ts.begin();											// touch screen begin
 	ts.setRotation(SCREEN_ROTATION);							// set touch rotation
@@ -103,9 +114,20 @@ void setup()
 	// set circular buffer default sample size
 	samples = optDefault.val;
 
+#ifdef FAST_MATH
+	// build dBm, swr lookup tables
+	initFastMath();
+#endif
+
 	// initialise ADC, set interrupt timer
 	initADC();
 
+	// envelope statistics threshold and bin powers
+	initEnvStats();
+
+	// swr protection trip levels
+	initProtect();
+
 	// display splash screen
 	analogWrite(DIM_PIN, TFT_FULL);
 	splashScreen();
@@ -132,14 +154,21 @@ void loop()
 	// blink indicator
 	heartBeat();
 
+	// swr protection - cut power on trip
+	protectMain();
+
+	// idle - no power, getADC() wakes on power on
+	bool idle = idleMain();
+
 	// measure & display power, swr etc - main function
-	measure();
+	if (!idle)
+		measure();
 
 #ifdef CIV
 	// blueTooth();										// test only
 
-	// do following if civMode enabled
-	if (isCivEnable)
+	// do following if civMode enabled, slow polling when idle
+	if (isCivEnable && (!idle || civPollTimer.check()))
 	{
 		// get and display frequency
 		currFreq = getFreq();
@@ -168,7 +197,11 @@ void loop()
 		if (fr[txPwr].isEnable)
 			txPwrMain();
 		else
+		{
 			displayValue(sRef, getRef());
+			if (txPwrTimer.check())
+				getTxPwr();								// refresh power level for protectMain()
+		}
 	}
 #endif
 
@@ -179,11 +212,15 @@ void loop()
 	// check if screen has been touched
 	if (ts.tirqTouched())
 	{
+		idleReset();									// touch - restart measure()
 		if (isDim)
 			resetDimmer();								// reset dimmer
-		else
+		else if (!optTouch())							// options screen, else main screen
 			chkTouchFrame(sizeof(fr) / sizeof(frame));					// check for touch or button press
 	}
+
+	// frame buffer to tft
+	updateDisplay(false);
 }
 
 /*------------------------------------------------------------------------------------------
@@ -215,6 +252,9 @@ void initDisplay()
 		// set current frequency for freq difference tuner
 		val[tuner].prevDispVal = currFreq;
 
+		// radio power level for swr protection restore
+		getTxPwr();
+
 		//frequency tune initialise
 		// use (0) as it's a program call
 		freqTuneButton(0);
@@ -262,6 +302,9 @@ void drawDisplay()
 	// display samples / options button
 	avgOptionsLabel();
 
+	// frame buffer to tft, wait for complete screen
+	updateDisplay(true);
+
 	// turn screen on full bright
 	analogWrite(DIM_PIN, TFT_FULL);
 }
@@ -305,6 +348,7 @@ void splashScreen()
 
 	tft.setFont(FONT16);
 	displayTextCentred(line2, y + 100);
+	updateDisplay(true);
 
 	// hold display
 	for (int i = 0; i < SPLASH_DELAY / 10; i++)
@@ -377,6 +421,10 @@ void heartBeat()
 	static bool isHeartBeat;
 	int x = 10, y = 10;
 
+	// not over options screen header
+	if (optView != noView)
+		return;
+
 	tft.setFont(FONT_HB);
 
 	if (heartBeatTimer.check())
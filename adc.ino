@@ -23,6 +23,17 @@ ADC::Sync_result result;						    // ADC result structure
 IntervalTimer sampleTimer;						    // getADC interupt timer
 volatile long a0Avg, a1Avg;							// circular buffer averages
 volatile unsigned int a0Peak, a1Peak;				// circular buffer peak values
+volatile int currProf = lowNoiseProf;				// current ADC profile - see adcProf[]
+volatile int sampleFreq = SAMPLE_FREQ;				// current sampling frequency - hertz
+volatile int statsWeight = 1;						// envelope statistics count per sample
+volatile int decimation = 1;						// samples per buffer sample, sampleFreq / SAMPLE_FREQ
+unsigned int adcMaxCode;							// ADC max value, set by initADC()
+unsigned int profUpCode, profDownCode;				// fwd ADC codes for profile switch
+volatile bool isIdle = false;						// idle - low sample rate, no buffers. see idle.ino
+volatile unsigned long wakeMicros;					// time of wake from idle (microsecs)
+unsigned int wakeCode;								// fwd ADC code to wake from idle
+volatile bool isTrip = false;						// swr protection trip latched. see protect.ino
+volatile unsigned long tripMicros;					// time of trip (microsecs)
 
 
 
@@ -37,9 +48,15 @@ void getADC()
 
 	volatile static int count = 0;								// ADC circular buffer sample count
 	volatile static int currSamples = 0, prevSamples = 0;
+	volatile static int filled = 0;								// buffer samples in averages, up to currSamples
 	volatile static long a1Sum = 0, a0Sum = 0;					// sum of buffer samples
-	volatile static unsigned int a1Sample[MAXBUF + 1] = {};		// fwd buffer used by interrupt routine
-	volatile static unsigned int a0Sample[MAXBUF + 1] = {};		// ref buffer used by interrupt routine
+	volatile static adcPair sample[MAXBUF + 1] = {};			// fwd / ref buffer used by interrupt routine
+	static_assert(FAST_SAMPLE_FREQ % SAMPLE_FREQ == 0, "fast profile samples are averaged into SAMPLE_FREQ buffer samples");
+	volatile static long blkSum = 0, refBlkSum = 0;				// fwd, ref sums for profile and protection check
+	volatile static int blkCount = 0;
+	volatile static long decFwd = 0, decRef = 0;				// fast profile samples for next buffer sample
+	volatile static int decCount = 0;
+	adcProfile* pPtr = &adcProf[currProf];
 
 	// samples set by options
 	// set as % of buffer space
@@ -48,44 +65,92 @@ void getADC()
 	else
 		currSamples = 1;
 
-	// check for change of currSamplesAvg, reset buffers, etc
+	// check for change of currSamplesAvg, restart averages
+	// buffer is not cleared, only samples written since restart are removed from sums
 	if (currSamples != prevSamples)
 	{
-		for (int i = 0; i < MAXBUF; i++)
-		{
-			a1Sample[i] = 0;
-			a0Sample[i] = 0;
-		}
 		count = 0;
+		filled = 0;
 		a1Sum = 0;
 		a0Sum = 0;
 		a1Peak = 0;
 		a0Peak = 0;
+		prevSamples = currSamples;
 	}
 
 	// read ADC, both channels. 16bit needs unsigned
+	// results converted to low noise profile scale
 	result = adc->analogSyncRead(FWD_ADC_PIN, REF_ADC_PIN);
+	unsigned int fwd = adcScale((uint16_t)result.result_adc1, pPtr->gainQ16, pPtr->fwdOffs);
+	unsigned int ref = adcScale((uint16_t)result.result_adc0, pPtr->gainQ16, pPtr->refOffs);
 
-	// circular / FIFO buffer (moving) averaging
-	// do reflected power first to have refS[sample] for peak
-	a0Sum = a0Sum - a0Sample[count];							// remove oldest from running total
-	a0Sample[count] = (uint16_t)result.result_adc0;				// save result
-	a0Sum = a0Sum + a0Sample[count];							// add newest to running total
+	// idle - only check for power on, buffers not updated
+	// first sample above threshold restores profile sample rate and continues, counted once below
+	if (isIdle)
+	{
+		if (fwd < wakeCode)
+		{
+			envStatsSample(fwd);
+			return;
+		}
+
+		isIdle = false;
+		wakeMicros = micros();
+		setSampleFreq(pPtr->sampleFreq);
+	}
+
+	// forward sample to envelope statistics
+	envStatsSample(fwd);
+
+	// peak forward sample + corresponding reflected, every sample at either profile rate
+	if (fwd > a1Peak)
+	{
+		a1Peak = fwd;
+		a0Peak = ref;
+	}
+
+	// ADC profile and swr protection - check averages of sample block
+	blkSum += fwd;
+	refBlkSum += ref;
+	blkCount++;
+	if (blkCount >= (1 << PROF_BLOCK_BITS))
+	{
+		adcProfileCheck(blkSum >> PROF_BLOCK_BITS);
+		protectCheck(blkSum >> PROF_BLOCK_BITS, refBlkSum >> PROF_BLOCK_BITS);
+		blkSum = 0;
+		refBlkSum = 0;
+		blkCount = 0;
+	}
 
-	a1Sum = a1Sum - a1Sample[count];
-	a1Sample[count] = (uint16_t)result.result_adc1;
-	a1Sum = a1Sum + a1Sample[count];
+	// fast profile - average sampleFreq / SAMPLE_FREQ samples into one buffer sample
+	// buffer is always at SAMPLE_FREQ, so averaging time does not change with profile
+	decFwd += fwd;
+	decRef += ref;
+	decCount++;
+	if (decCount < decimation)
+		return;
+	unsigned int bufFwd = decFwd / decCount;
+	unsigned int bufRef = decRef / decCount;
+	decFwd = 0;
+	decRef = 0;
+	decCount = 0;
 
-	// peak forward sample + corresponding reflected
-	if (a1Sample[count] > a1Peak)
+	// circular / FIFO buffer (moving) averaging
+	if (filled == currSamples)
 	{
-		a1Peak = a1Sample[count];
-		a0Peak = a0Sample[count];
+		a0Sum = a0Sum - sample[count].ref;						// remove oldest from running total
+		a1Sum = a1Sum - sample[count].fwd;
 	}
+	else
+		filled++;
+	sample[count].ref = bufRef;
+	a0Sum = a0Sum + sample[count].ref;							// add newest to running total
+	sample[count].fwd = bufFwd;
+	a1Sum = a1Sum + sample[count].fwd;
 
 	// averages
-	a1Avg = a1Sum / currSamples;
-	a0Avg = a0Sum / currSamples;
+	a1Avg = a1Sum / filled;
+	a0Avg = a0Sum / filled;
 
 	// increment sample, if max currAvgSamples, back to start
 	count++;
@@ -93,38 +158,125 @@ void getADC()
 	{
 		count = 0;
 		// reset peaks to current sample
-		a1Peak = a1Sample[count];
-		a0Peak = a0Sample[count];
+		a1Peak = fwd;
+		a0Peak = ref;
 
 		//digitalWrite(TEST_PIN, !digitalRead(TEST_PIN));
 	}
-	prevSamples = currSamples;
 
 	//digitalWriteFast(TEST_PIN, LOW);
 }
 
+/*--------------------------------- adcScale() ---------------------------------------
+converts ADC result to low noise profile scale
+gain is 16 bit fixed point, offset in ADC codes
+*/
+unsigned int adcScale(unsigned int code, int gainQ16, int offs)
+{
+	long c = (long)(((int64_t)code * gainQ16) >> 16) + offs;
+	if (c < 0)
+		c = 0;
+	if (c > (long)adcMaxCode)
+		c = adcMaxCode;
+	return c;
+}
+
+/*--------------------------------- adcProfileCheck() ---------------------------------
+called by getADC() with block average forward code
+switches ADC profile with hysteresis, up and down codes from PROF_UP_PWR, PROF_DOWN_PWR
+*/
+void adcProfileCheck(unsigned int code)
+{
+	if (currProf == lowNoiseProf && code > profUpCode)
+		setAdcProfile(fastProf);
+	else if (currProf == fastProf && code < profDownCode)
+		setAdcProfile(lowNoiseProf);
+}
+
+/*--------------------------------- setAdcProfile() -----------------------------------
+sets ADC averaging, speeds and sample timer interval for profile
+called by getADC() between conversions, and initADC()
+*/
+void setAdcProfile(int prof)
+{
+	adcProfile* pPtr = &adcProf[prof];
+
+	// ADC 0
+	adc->adc0->setAveraging(pPtr->averaging);
+	adc->adc0->setConversionSpeed(pPtr->convSpeed);
+	adc->adc0->setSamplingSpeed(pPtr->sampleSpeed);
+
+	// ADC 1
+	adc->adc1->setAveraging(pPtr->averaging);
+	adc->adc1->setConversionSpeed(pPtr->convSpeed);
+	adc->adc1->setSamplingSpeed(pPtr->sampleSpeed);
+
+	setSampleFreq(pPtr->sampleFreq);
+	currProf = prof;
+}
+
+/*--------------------------------- setSampleFreq() -----------------------------------
+sets sample timer interval (microseconds), statistics weight and buffer decimation for sample rate
+*/
+void setSampleFreq(int freq)
+{
+	sampleFreq = freq;
+	statsWeight = STATS_FREQ / sampleFreq;
+	decimation = max(1, sampleFreq / SAMPLE_FREQ);
+	sampleTimer.update(1000000 / sampleFreq);
+}
+
+/*--------------------------------- setIdle() -----------------------------------
+idle - drop to IDLE_SAMPLE_FREQ, getADC() wakes on power
+called by idleMain() and idleReset()
+*/
+void setIdle(bool idle)
+{
+	noInterrupts();
+	isIdle = idle;
+	if (idle)
+	{
+		wakeMicros = 0;									// last wake not displayed above threshold, not recorded
+		setSampleFreq(IDLE_SAMPLE_FREQ);
+	}
+	else
+		setSampleFreq(adcProf[currProf].sampleFreq);
+	interrupts();
+}
+
 
 
 /*---------------------------------------- initADC() ----------------------------------
 initialises Analog-Digital convertor
-sets resolution, conversion speeds
+sets resolution, low noise profile - averaging, conversion speeds
 interrupt timer interval*/
 void initADC()
 {
-	// set up ADC convertors - ADC 0
-	adc->adc0->setAveraging(AVERAGING); 								// set number of averages,(0,4,18,16,32)
+	// set up ADC convertors, resolution is the same for all profiles
 	adc->adc0->setResolution(RESOLUTION); 								// set bits of resolution (8,10,12, 16 (Teensy 3.2 )
-	adc->adc0->setConversionSpeed(ADC_CONVERSION_SPEED::CONV_SPEED);	// change the conversion speed
-	adc->adc0->setSamplingSpeed(ADC_SAMPLING_SPEED::SAMPLE_SPEED);		// change the sampling speed
-
-	// ADC 1
-	adc->adc1->setAveraging(AVERAGING);
 	adc->adc1->setResolution(RESOLUTION);
-	adc->adc1->setConversionSpeed(ADC_CONVERSION_SPEED::CONV_SPEED);
-	adc->adc1->setSamplingSpeed(ADC_SAMPLING_SPEED::SAMPLE_SPEED);
+	adcMaxCode = adc->adc0->getMaxValue();
+
+	// profile gain and zero offsets, relative to low noise profile
+	float adcConvert = 3.3 / adcMaxCode;
+	for (unsigned int i = 0; i < sizeof(adcProf) / sizeof(adcProfile); i++)
+	{
+		adcProfile* pPtr = &adcProf[i];
+		pPtr->gainQ16 = pPtr->gain * 65536;
+		pPtr->fwdOffs = round((pPtr->fvZeroAdj - adcProf[lowNoiseProf].fvZeroAdj) / adcConvert);
+		pPtr->refOffs = round((pPtr->rvZeroAdj - adcProf[lowNoiseProf].rvZeroAdj) / adcConvert);
+	}
+
+	// profile switch and idle wake codes
+	profUpCode = pwrToCode(PROF_UP_PWR);
+	profDownCode = pwrToCode(PROF_DOWN_PWR);
+	wakeCode = pwrToCode(PWR_THRESHOLD);
+
+	// start with low noise - averaging, speeds, sampleFreq
+	setAdcProfile(lowNoiseProf);
 
 	// set up interrupt timer (microseconds
-	// SAMPLE_FREQ in hertz - eg 5000
-	sampleTimer.begin(getADC, 1000000 / SAMPLE_FREQ);
+	// sampleFreq in hertz - eg 5000
+	sampleTimer.begin(getADC, 1000000 / sampleFreq);
 }
 
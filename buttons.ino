@@ -46,6 +46,16 @@ void dbmButton(int tStat)
 	restoreFrame(netPower);
 }
 
+/*------------------------ retLossButton()------------------------------------
+return loss displayed by vswr short touch
+short touch restores to vswr display
+*/
+void retLossButton(int tStat)
+{
+	eraseFrame(retLoss);
+	restoreFrame(vswr);
+}
+
 /*-----------------------------peakPwrButton() --------------------------------------------------
 short touch(1) - swap from Peak average power to PEP
 long touch(2) - calibrate mode
@@ -88,7 +98,8 @@ void peakPwrButton(int tStat)
 }
 
 /*---------------------- swrButton ------------------------------
-short touch - swap from one decimal to two decmal places
+short touch - swap from one decimal to two decmal places,
+			  then to return loss
 long touch - reboot
 */
 void swrButton(int tStat)
@@ -108,9 +119,19 @@ void swrButton(int tStat)
 			val[vswr].font = FONT24;
 			strncpy(val[vswr].fmt, "%3.2", 4);
 		}
+
+		// two decimals displayed, swap to return loss
+		// else redisplay with new decimals
+		if (!isDefault)
+		{
+			eraseFrame(vswr);
+			restoreFrame(retLoss);
+		}
+		else
+			restoreFrame(vswr);
+
 		// toggle status flag
 		isDefault = !isDefault;
-		restoreFrame(vswr);
 	}
 
 	//reboot;
@@ -225,7 +246,7 @@ void optionsButton(int tStat)
 
 	//  long touch - set averaging options
 	if (tStat == 2)
-		setAvgSamples();
+		optViewOpen(avgView);
 }
 
 /*---------------------- optionsLabel() -------------------------------
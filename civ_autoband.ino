@@ -40,11 +40,9 @@ void aBandButton(int tStat)
 	case SHORTTOUCH:								// swap on/off
 		lab[aBand].stat = !lab[aBand].stat;			// toggle start/stop
 		break;
-	case LONGTOUCH:									// set options
-		countDown = aBandCountDown;					// save current coundown
-		tunerABandOpts();							// options
-		drawDisplay();							
-		break;
+	case LONGTOUCH:									// set options, restored by options Exit
+		optViewOpen(tuneABandView);
+		return;
 	default:										// don't come here
 		break;
 	}
@@ -34,10 +34,9 @@ void freqTuneButton(int tStat)
 	case SHORTTOUCH:									// swap on/off
 		lab[freqTune].stat = !lab[freqTune].stat;
 		break;
-	case LONGTOUCH:										// set options
-		tunerABandOpts();
-		drawDisplay();								// restore display + freq difference
-		break;
+	case LONGTOUCH:										// set options, restored by options Exit
+		optViewOpen(tuneABandView);
+		return;
 	default:											// don't come here
 		break;
 	}
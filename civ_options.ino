@@ -10,67 +10,43 @@ No publication without acknowledgement to author
 
 #ifdef CIV
 
-/*------------------- tunerABandOpts() --------------------------------------------
-Options 0 - enter here after long touch on FreqTune or ABand buttons
+/*------------------- tunerABandOptsTouch() --------------------------------------------
+Options 0 - opened by long touch on FreqTune or ABand buttons, see optViewOpen()
+n = touch index from optTouch()
 
-darw tunerAband option
-set the options
-check exit option touched
-
-calls freqTimeOpts() to draw check circles/ boxes for tuning and auto band
-calls setParamOpts to set tuner frequency difference and band change time
+sets freqTune and autoBand enable for band
+Exit closes options, More.. opens setTunerAbandTimeOpts screen
 */
-void tunerABandOpts()							// set frequency difference to trigger autotune
+void tunerABandOptsTouch(int n)
 {
-	int tNum, chkNum;							// drawTouchBoxOpts Number, number selected box
+	int bNum = n / 2;								// band number
 
-	// loop until Exit touched
-	do
+	// get number of item touched. Ignore -1 (touched but no item)
+	if (n < NUM_BANDS * 2 && n != -1)
 	{
-		tft.fillScreen(BG_COLOUR);
-		tft.setTextColor(FG_COLOUR);
-
-		// reset chkNum for loop to work
-		chkNum = 0;
-
-		// draw check boxes for startBand to endBand + Exit & More..
-		tNum = drawTunerABandOpts();
-
-		// accept option changes until Exit or More.. is touched
-		do
+		// even number selected - freqTune Options
+		if (!(n % 2))
 		{
-			if (ts.tirqTouched())
-			{
-				chkNum = chkTouchOption(tNum, false);
-				int bNum = chkNum / 2;				// band number
-
-				// get number of item touched. Ignore -1 (touched but no item)
-				if (chkNum < NUM_BANDS * 2 && chkNum != -1)
-				{
-					// even number selected - freqTune Options
-					if (!(chkNum % 2))
-					{
-						hfBand[bNum].isFTune = !hfBand[bNum].isFTune;
-						drawCircleOpts(tb[chkNum].x, tb[chkNum].y, hfBand[bNum].isFTune, chkNum);
-					}
-					// odd number - freqTune Options
-					else
-					{
-						hfBand[bNum].isABand = !hfBand[bNum].isABand;
-						drawCircleOpts(tb[chkNum].x, tb[chkNum].y, hfBand[bNum].isABand, chkNum);
-					}
-					// update EEPROM
-					hfProm[bNum].isFTune = hfBand[bNum].isFTune;
-					hfProm[bNum].isABand = hfBand[bNum].isABand;
-					putBandEEPROM(bNum);					// save data to EEPROM
-				}
-			}
-		} while (chkNum < NUM_BANDS * 2);
-
-		// bNum is either Exit or More..(last touch item - tNum)
-		if (chkNum == tNum)
-			setTunerAbandOpts();						// More... selected
-	} while (chkNum != (tNum - 1));				// Exit
+			hfBand[bNum].isFTune = !hfBand[bNum].isFTune;
+			drawCircleOpts(tb[n].x, tb[n].y, hfBand[bNum].isFTune, n);
+		}
+		// odd number - freqTune Options
+		else
+		{
+			hfBand[bNum].isABand = !hfBand[bNum].isABand;
+			drawCircleOpts(tb[n].x, tb[n].y, hfBand[bNum].isABand, n);
+		}
+		// update EEPROM
+		hfProm[bNum].isFTune = hfBand[bNum].isFTune;
+		hfProm[bNum].isABand = hfBand[bNum].isABand;
+		putBandEEPROM(bNum);					// save data to EEPROM
+	}
+
+	// More... or Exit (last touch item - optTouchNum)
+	if (n == optTouchNum)
+		optViewOpen(tuneTimeView);
+	else if (n == optTouchNum - 1)
+		optViewClose();
 }
 
 /*--------------------- drawTunerABandOpts() --------------------
@@ -141,17 +117,17 @@ int drawTunerABandOpts()
 	return numBoxes;
 }
 
-/*----------------------- setFreqTimerOpts() -------------------------
-set tune freq difference and ft8 band change time
+/*----------------------- drawTunerAbandTimeOpts() -------------------------
+Options screen 2
+tune freq difference and ft8 band change time
+returns last touch index, Exit
 */
-void setTunerAbandOpts()
+int drawTunerAbandTimeOpts()
 {
 	int x = 40, y;
-	int tIndex = 0, n = 0;
-	bool isFlg;
+	int tIndex = 0;
 	char txt[] = "On at Startup";
 
-	tft.fillScreen(BG_COLOUR);
 	tft.setFont(FONT14);
 	tft.setTextColor(WHITE);
 
@@ -183,64 +159,71 @@ void setTunerAbandOpts()
 	x = 135; y = 210;
 	drawTextBoxOpts(x, y, "Exit", tIndex);
 
-	// check for touch changes
-	do
+	return tIndex;
+}
+
+/*----------------------- tunerAbandTimeOptsTouch() -------------------------
+set tune freq difference and ft8 band change time
+n = touch index from optTouch(), Exit returns to Options 0
+*/
+void tunerAbandTimeOptsTouch(int n)
+{
+	bool isFlg = false;
+
+	switch (n)
 	{
-		// check which box touched
-		n = chkTouchOption(tIndex, false);
-		isFlg = false;
+	case 0:
+		// set/reset Freq Tune Flag for startup
+		optFreqTune.isFlg = !optFreqTune.isFlg;
+		isFlg = optFreqTune.isFlg;
+		drawCircleOpts(tb[n].x, tb[n].y, isFlg, n);
+		break;
+	case 1:
+		// set/reset aBand Flag for startup
+		optABand.isFlg = !optABand.isFlg;
+		isFlg = optABand.isFlg;
+		drawCircleOpts(tb[n].x, tb[n].y, isFlg, n);
+		break;
+	case 2:
+		// increase / decrease frquency
+		optFreqTune.val += 20;
+		break;
+	case 3:
+		optFreqTune.val -= 20;
+		if (optFreqTune.val <= 0)
+			optFreqTune.val = 20;
+		break;
+		// increase/decrease time
+	case 4:
+		optABand.val += 15;
+		break;
+	case 5:
+		optABand.val -= 15;
+		if (optABand.val <= 0)
+			optABand.val = 15;
+		break;
+
+		// Exit box
+	case 6:
+	default:
+		break;
+	}
 
-		switch (n)
-		{
-		case 0:
-			// set/reset Freq Tune Flag for startup
-			optFreqTune.isFlg = !optFreqTune.isFlg;
-			isFlg = optFreqTune.isFlg;
-			drawCircleOpts(tb[n].x, tb[n].y, isFlg, n);
-			break;
-		case 1:
-			// set/reset aBand Flag for startup
-			optABand.isFlg = !optABand.isFlg;
-			isFlg = optABand.isFlg;
-			drawCircleOpts(tb[n].x, tb[n].y, isFlg, n);
-			break;
-		case 2:
-			// increase / decrease frquency
-			optFreqTune.val += 20;
-			break;
-		case 3:
-			optFreqTune.val -= 20;
-			if (optFreqTune.val <= 0)
-				optFreqTune.val = 20;
-			break;
-			// increase/decrease time
-		case 4:
-			optABand.val += 15;
-			break;
-		case 5:
-			optABand.val -= 15;
-			if (optABand.val <= 0)
-				optABand.val = 15;
-			break;
-
-			// Exit box
-		case 6:
-		default:
-			break;
-		}
+	// no touch item
+	if (n == -1)
+		return;
 
-		// update display
-		displayValue(freqTuneOpt, optFreqTune.val);
-		displayValue(aBandTimeOpt, optABand.val);
+	// update display
+	displayValue(freqTuneOpt, optFreqTune.val);
+	displayValue(aBandTimeOpt, optABand.val);
 
-		// save structures to EEPROM
-		EEPROM.put(optFreqTune.eeAddr, optFreqTune);;
-		EEPROM.put(optABand.eeAddr, optABand);;
-	} while (n != tIndex);		// last item is Exit
+	// save structures to EEPROM
+	EEPROM.put(optFreqTune.eeAddr, optFreqTune);;
+	EEPROM.put(optABand.eeAddr, optABand);;
 
-	// clean up
-	eraseFrame(freqTuneOpt);
-	eraseFrame(aBandTimeOpt);
+	// last item is Exit
+	if (n == optTouchNum)
+		optViewOpen(tuneABandView);
 }
 
 #endif
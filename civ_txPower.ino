@@ -16,6 +16,8 @@ Only map before display to prevent accumulated rounding errors
 
 #ifdef CIV
 
+int txPwrLevel = 0;										// last good power setting read or set, see protectMain()
+
 /*--------------------------- txPwrButton() ----------------------------------------------------------------
 short touch - toggles set TXPower between original setting and 100%
 long touch  - changes to spectrum reference
@@ -70,7 +72,7 @@ void txPwrMain()
 
 /*-------------------------------- getTxPwr() --------------------------------------------------------
 reads RF Power setting from radio
-Returns pwr = 0-255 (0-100%)
+Returns pwr = 0-255 (0-100%), last good setting if reply is not valid
 int	civReadTxPwr[] =    { 0x14, 0x0A, 0xFD };			// read RF Power setting
 */
 int getTxPwr()
@@ -78,30 +80,30 @@ int getTxPwr()
 	int n;												// chars read into budder
 	unsigned int h = 0, u = 0;							// hundreds, units
 	char inBuff[12];										// civ frequency inBuff buffer
-	int pwr = 0;
 
 	civWrite(civReadTxPwr);								// request read power setting from radio
 	n = civRead(inBuff);								// get number of characters in buffer (9)
-	if (inBuff[3] == CIVRADIO && inBuff[n - 1] == 0xFD)	// check format of serial stream
+	if (n > 0 && inBuff[3] == CIVRADIO && inBuff[n - 1] == 0xFD)	// check format of serial stream
 	{
 		h = getBCD(inBuff[n - 3]);						// hundreds, convert from BCD
 		u = getBCD(inBuff[n - 2]);						// units
+		txPwrLevel = h * 100 + u;						// add hundreds and units, cache for swr protection
 	}
-	pwr = h * 100 + u;									// add hundreds and units to get power
-	return pwr;
+	return txPwrLevel;
 }
 
 /*------------------------------ putTxPwr() -------------------------------
 set Tx %power, 0-100.
 range 0-255 (= 0-100%), converts decimcal to BCD, write C-IV command
-returns pwr
+returns chars written, 0 if C-IV write failed
 
 int	civWriteTxPwr[] =   { 0x14, 0x0A, 0x00, 0x00, 0xFD };	// set RF Power
 
 */
-void putTxPwr(int pwr)
+int putTxPwr(int pwr)
 {
 	unsigned int h, u;									// hundreds and units
+	int n;												// chars written
 
 	h = pwr / 100;										// 100s
 	u = pwr % 100;										// units
@@ -109,7 +111,10 @@ void putTxPwr(int pwr)
 	civWriteTxPwr[2] = putBCD(h);						// constant expression
 	civWriteTxPwr[3] = putBCD(u);						
 
-	civWrite(civWriteTxPwr);							// write it, 0-255
+	n = civWrite(civWriteTxPwr);						// write it, 0-255
+	if (n)
+		txPwrLevel = pwr;								// cache for swr protection
+	return n;
 }
 
 #endif
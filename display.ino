@@ -12,7 +12,7 @@ No publication without acknowledgement to author
 /*
 display functions
 drawframe(), displayLabel(), displayValue(), drawMeterScale(), displayMeter()
-invertLabel(), eraseFrame();
+invertLabel(), eraseFrame(), updateDisplay();
 */
 
 
@@ -32,7 +32,7 @@ void displayLabel(int posn, char* txt)						// call with frame postion + str
 	if (txt == NULL)										// if called with 1st arg only
 		txt = lab[posn].txt;								// set text
 
-	if (!fPtr->isEnable) return;							// check enabled
+	if (!fPtr->isEnable || fPtr->isHide) return;			// check enabled, not hidden
 
 	// draw associated frame
 	drawFrame(posn);
@@ -91,8 +91,8 @@ void displayValue(int posn, float currVal, bool isUpdate)	// frame position, flo
 		strKeep[buffSize + 1] = {};
 	int pixLenCurr, pixLenPrev, pixLenLabel, pixLenKeep;		// pixel lentghs of string values
 
-	// return if disabled
-	if (!fPtr->isEnable) return;
+	// return if disabled or hidden
+	if (!fPtr->isEnable || fPtr->isHide) return;
 
 	// convert floats to strings and compare to detect position changes
 	// scan strings left to right.  erase from changed position
@@ -211,8 +211,8 @@ void drawMeter(int posn, float curr, float peak)
 	value* vPtr = &val[posn];
 	meter* mPtr = &mtr[posn - netPwrMeter];							// adjust for array position
 
-	// if frame disabled return
-	if (!fPtr->isEnable) return;
+	// if frame disabled or hidden return
+	if (!fPtr->isEnable || fPtr->isHide) return;
 
 	// y axis parameters
 	int y = fPtr->y + 10;												// vertical posn for meter
@@ -273,8 +273,8 @@ void drawMeterScale(int posn)
 	frame* fPtr = &fr[posn];
 	meter* mPtr = &mtr[posn - netPwrMeter];
 
-	// return if not enabled
-	if (!fPtr->isEnable)
+	// return if not enabled or hidden
+	if (!fPtr->isEnable || fPtr->isHide)
 		return;
 
 	// x,y start posns. allow for gaps to frame
@@ -338,8 +338,8 @@ void drawFrame(int posn)
 {
 	frame* fPtr = &fr[posn];
 
-	// draw frame if enabled
-	if (fPtr->isEnable)
+	// draw frame if enabled and not hidden
+	if (fPtr->isEnable && !fPtr->isHide)
 	{
 		// filled rectangle
 		tft.fillRoundRect(fPtr->x, fPtr->y, fPtr->w, fPtr->h, RADIUS, fPtr->bgColour);
@@ -356,6 +356,8 @@ void eraseFrame(int posn)
 {
 	fr[posn].isEnable = false;							// disable flags
 	fr[posn].isTouch = false;
+	if (fr[posn].isHide)								// options screen open, not drawn
+		return;
 	// fill inside frame with background
 	tft.fillRoundRect(fr[posn].x, fr[posn].y,			// erase frame - fill with background colour
 		fr[posn].w, fr[posn].h, RADIUS, BG_COLOUR);
@@ -397,3 +399,47 @@ void invertLabel(int posn)
 	lab[posn].colour = col;
 	displayLabel(posn);										// draw label
 }
+
+
+/*------------------------------- updateDisplay() ----------------------------------------
+frame buffer - starts DMA of whole drawn buffer (320x240) to tft, drawing continues in other buffer
+			   only the changed area is copied to the other buffer
+			   nothing drawn since last update - no DMA
+			   isWait = true, waits for previous and this transfer to complete
+			   isWait = false, returns if previous transfer not complete
+direct - nothing to do, drawing is on tft
+*/
+void updateDisplay(bool isWait)
+{
+#ifdef FRAME_BUFFER
+	static int buffNum = 0;								// buffer being drawn, set by setup()
+	int x, y, w, h;										// changed area
+
+	if (!tft.changedArea(&x, &y, &w, &h))
+	{
+		if (isWait)
+			tft.waitUpdateAsyncComplete();
+		return;
+	}
+
+	if (tft.asyncUpdateActive())
+	{
+		if (!isWait)
+			return;
+		tft.waitUpdateAsyncComplete();
+	}
+
+	// send drawn buffer, draw in other buffer
+	// buffers are the same outside the changed area, copy changed area rows only
+	tft.updateScreenAsync(false);
+	tft.clearChangedArea();
+	int sent = buffNum;
+	buffNum ^= 1;
+	for (int row = y; row < y + h; row++)
+		memcpy(&tftBuff[buffNum][row * tft.width() + x], &tftBuff[sent][row * tft.width() + x], w * sizeof(uint16_t));
+	tft.setFrameBuffer(tftBuff[buffNum]);
+
+	if (isWait)
+		tft.waitUpdateAsyncComplete();
+#endif
+}
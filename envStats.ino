@@ -0,0 +1,289 @@
+/*-----------------------------------------------------------------------------------
+SWR / POWER METER + IC7300 C-IV CONTROLLER
+
+Swr/PowerMeter (basic) - https://github.com/GI8GZM/PowerSwrMeter
+Swr/PowerMeter + IC7300 C-IV Controller - https://github.com/GI8GZM/PowerMeter-CIVController
+
+ Copyright 2018-2020  Roger Mawhinney, GI8GZM.
+No publication without acknowledgement to author
+-------------------------------------------------------------------------------------*/
+
+
+// envStats.ino
+// envelope statistics - peak to average ratio, CCDF, transmit duty cycle
+// envStatsSample() is called by getADC() for every forward sample
+// histograms are log binned on the ADC code, no division, fixed size
+
+/*---------------------------------------------------------
+histogram bins
+codes below 2^STATS_SUB_BITS have a bin each, above that
+each octave of ADC code is split into 2^STATS_SUB_BITS bins
+
+window is STATS_SECS one second slots, oldest second is
+subtracted from the window totals when a new second starts
+
+samples are counted with statsWeight, so slow and fast ADC profiles
+count the same for the same time
+*/
+volatile uint16_t statsSecHist[STATS_SECS][STATS_BINS];		// keyed sample histogram per second
+volatile uint16_t statsSecPeak[STATS_SECS];					// peak fwd code per second
+volatile uint16_t statsSecKeyed[STATS_SECS];				// keyed samples per second
+volatile uint16_t statsSecTotal[STATS_SECS];				// all samples per second
+volatile uint32_t statsHist[STATS_BINS];					// window histogram
+volatile uint32_t statsKeyed, statsTotal;					// window sample counts
+volatile int statsSlot = 0;									// current second
+unsigned int statsThreshCode = 0xFFFF;						// fwd code for PWR_THRESHOLD, set by initEnvStats()
+float statsBinPwr[STATS_BINS];								// power (watts) at bin centre
+uint32_t statsCopy[STATS_BINS];								// window histogram copy, see getEnvStats()
+uint32_t statsCopyKeyed;
+
+
+
+/*--------------------------------- envStatsSample() --------------------------------------
+called by getADC() interrupt for each forward ADC sample
+*/
+void envStatsSample(unsigned int code)
+{
+	int slot = statsSlot;
+
+	// keyed (power on) samples only
+	if (code >= statsThreshCode)
+	{
+		int bin = statsBin(code);
+		statsSecHist[slot][bin] += statsWeight;
+		statsHist[bin] += statsWeight;
+		statsSecKeyed[slot] += statsWeight;
+		statsKeyed += statsWeight;
+		if (code > statsSecPeak[slot])
+			statsSecPeak[slot] = code;
+	}
+	statsSecTotal[slot] += statsWeight;
+	statsTotal += statsWeight;
+
+	// one second of samples, move to next slot and drop oldest second
+	if (statsSecTotal[slot] >= STATS_FREQ)
+	{
+		slot++;
+		if (slot >= STATS_SECS)
+			slot = 0;
+
+		for (int i = 0; i < STATS_BINS; i++)
+		{
+			statsHist[i] -= statsSecHist[slot][i];
+			statsSecHist[slot][i] = 0;
+		}
+		statsKeyed -= statsSecKeyed[slot];
+		statsTotal -= statsSecTotal[slot];
+		statsSecKeyed[slot] = 0;
+		statsSecTotal[slot] = 0;
+		statsSecPeak[slot] = 0;
+		statsSlot = slot;
+	}
+}
+
+/*--------------------------------- statsBin() --------------------------------------
+log bin number for ADC code
+*/
+int statsBin(unsigned int code)
+{
+	const int subBins = 1 << STATS_SUB_BITS;
+
+	if (code < subBins)
+		return code;
+
+	// octave = position of highest set bit
+	int octave = 31 - __builtin_clz(code);
+	int shift = octave - STATS_SUB_BITS;
+	return ((shift + 1) << STATS_SUB_BITS) + ((code >> shift) & (subBins - 1));
+}
+
+/*--------------------------------- statsBinLow() --------------------------------------
+lowest ADC code in bin, see statsBin()
+*/
+unsigned int statsBinLow(int bin)
+{
+	const int subBins = 1 << STATS_SUB_BITS;
+
+	if (bin < subBins)
+		return bin;
+
+	int shift = (bin >> STATS_SUB_BITS) - 1;
+	return (subBins + (bin & (subBins - 1))) << shift;
+}
+
+/*--------------------------------- statsBinCode() --------------------------------------
+ADC code at centre of bin
+*/
+float statsBinCode(int bin)
+{
+	if (bin < (1 << STATS_SUB_BITS))
+		return bin;
+
+	int shift = (bin >> STATS_SUB_BITS) - 1;
+	return statsBinLow(bin) + (float)(1 << shift) / 2;
+}
+
+
+
+/*------------------------------------ initEnvStats() ----------------------------------
+sets keyed threshold and bin powers from pwrCalc()
+called by setup() after initADC()
+*/
+void initEnvStats()
+{
+	float adcConvert = 3.3 / adc->adc0->getMaxValue();
+
+	for (int i = 0; i < STATS_BINS; i++)
+		statsBinPwr[i] = pwrCalc(statsBinCode(i) * adcConvert + FV_ZEROADJ);
+
+	statsThreshCode = pwrToCode(PWR_THRESHOLD);
+
+	// CCDF frame label, eg "0.1% dB"
+	sprintf(lab[ccdfPwr].txt, "%g%% dB", CCDF_LEVEL);
+}
+
+/*------------------------------------ getEnvStats() ----------------------------------
+calculates statistics for current window
+returns false if no keyed samples
+*/
+bool getEnvStats(envStat* sPtr)
+{
+	uint32_t* hist = statsCopy;
+	uint32_t keyed, total;
+	unsigned int pkCode = 0;
+
+	// copy window - stop / restart interrupts while copying
+	noInterrupts();
+	for (int i = 0; i < STATS_BINS; i++)
+		hist[i] = statsHist[i];
+	keyed = statsKeyed;
+	total = statsTotal;
+	for (int i = 0; i < STATS_SECS; i++)
+		if (statsSecPeak[i] > pkCode)
+			pkCode = statsSecPeak[i];
+	interrupts();
+	statsCopyKeyed = keyed;
+
+	sPtr->duty = 0.0;
+	if (total > 0)
+		sPtr->duty = 100.0 * keyed / total;
+
+	if (keyed == 0)
+	{
+		sPtr->par = 0.0;
+		sPtr->ccdf = 0.0;
+		sPtr->avgPwr = 0.0;
+		sPtr->pkPwr = 0.0;
+		return false;
+	}
+
+	// average keyed power
+	float sum = 0.0;
+	for (int i = 0; i < STATS_BINS; i++)
+		sum += hist[i] * statsBinPwr[i];
+	sPtr->avgPwr = sum / keyed;
+
+	// peak power, true peak sample - not bin centre
+	float adcConvert = 3.3 / adc->adc0->getMaxValue();
+	sPtr->pkPwr = pwrCalc(pkCode * adcConvert + FV_ZEROADJ);
+	sPtr->par = 0.0;
+	if (sPtr->pkPwr > sPtr->avgPwr)
+		sPtr->par = 10 * log10(sPtr->pkPwr / sPtr->avgPwr);
+
+	// ccdf - power exceeded for CCDF_LEVEL % of keyed samples
+	// count down from top bin until level reached
+	uint32_t limit = keyed * CCDF_LEVEL / 100;
+	uint32_t count = 0;
+	int bin = STATS_BINS - 1;
+	for (; bin > 0; bin--)
+	{
+		count += hist[bin];
+		if (count > limit)
+			break;
+	}
+	sPtr->ccdf = 0.0;
+	if (statsBinPwr[bin] > sPtr->avgPwr)
+		sPtr->ccdf = 10 * log10(statsBinPwr[bin] / sPtr->avgPwr);
+
+	return true;
+}
+
+/*------------------------------------ envStatsMain() ----------------------------------
+updates envelope statistic frames, called by measure()
+*/
+void envStatsMain()
+{
+	envStat s;
+
+	if (!fr[pkAvgRatio].isEnable || !statsTimer.check())
+		return;
+
+	getEnvStats(&s);
+	displayValue(pkAvgRatio, s.par);
+	displayValue(ccdfPwr, s.ccdf);
+	displayValue(dutyCycle, s.duty);
+}
+
+/*------------------------------------ printEnvStats() ----------------------------------
+prints statistics and CCDF table to USB serial
+called by measure() at end of transmission
+*/
+void printEnvStats()
+{
+	envStat s;
+
+	// getEnvStats() leaves window copy in statsCopy[]
+	if (!Serial || !getEnvStats(&s))
+		return;
+
+	Serial.printf("Avg %.1fW  Pk %.1fW  PAR %.1fdB  CCDF %.1f%% %.1fdB  Duty %.0f%%\n",
+		s.avgPwr, s.pkPwr, s.par, CCDF_LEVEL, s.ccdf, s.duty);
+
+	// % of keyed samples above average + dB
+	Serial.print("CCDF dB:%");
+	for (int dB = 0; dB < CCDF_STEPS; dB++)
+	{
+		float p = s.avgPwr * pow(10.0, dB / 10.0);
+		uint32_t count = 0;
+		for (int i = 0; i < STATS_BINS; i++)
+			if (statsBinPwr[i] > p)
+				count += statsCopy[i];
+		Serial.printf("  %d:%.2f", dB, 100.0 * count / statsCopyKeyed);
+	}
+	Serial.println();
+}
+
+
+
+/*------------------------------------ statsButton() ----------------------------------
+long touch on a meter - replace meter with envelope statistics
+any touch on statistics - restore meter
+*/
+void statsButton(int posn)
+{
+	static int statsMeter = netPwrMeter;					// meter replaced by statistics
+
+	if (posn == netPwrMeter || posn == swrMeter)
+	{
+		// statistic frames in a row at meter position
+		statsMeter = posn;
+		eraseFrame(posn);
+		for (int i = pkAvgRatio; i <= dutyCycle; i++)
+		{
+			fr[i].x = fr[posn].x + (i - pkAvgRatio) * (fr[i].w + GAP);
+			fr[i].y = fr[posn].y;
+			restoreFrame(i);
+		}
+	}
+	else
+	{
+		for (int i = pkAvgRatio; i <= dutyCycle; i++)
+			eraseFrame(i);
+
+		// meter bar is redrawn from scale start
+		restoreFrame(statsMeter);
+		drawMeterScale(statsMeter);
+		val[statsMeter].prevDispVal = mtr[statsMeter - netPwrMeter].sStart;
+		mtr[statsMeter - netPwrMeter].pkPrevPosn = fr[statsMeter].x;
+	}
+}
@@ -0,0 +1,130 @@
+/*-----------------------------------------------------------------------------------
+SWR / POWER METER + IC7300 C-IV CONTROLLER
+
+Swr/PowerMeter (basic) - https://github.com/GI8GZM/PowerSwrMeter
+Swr/PowerMeter + IC7300 C-IV Controller - https://github.com/GI8GZM/PowerMeter-CIVController
+
+ Copyright 2018-2020  Roger Mawhinney, GI8GZM.
+No publication without acknowledgement to author
+-------------------------------------------------------------------------------------*/
+
+
+// fastMath.ino
+// table based dBm, return loss and swr for measure()
+// replaces log10(), sqrt() and division in the measure loop
+// Teensy 3.2 has no FPU - all float maths is done in software
+
+#ifdef FAST_MATH
+
+/*---------------------------------------------------------
+lookup tables, built once at startup by initFastMath()
+log2Tab - log2(1 + m) for float mantissa m = 0 to 1
+			linear interpolation, max error 0.0002 dB
+swrTab  - swr for return loss 0 to RL_MAX, RL_TAB_STEP dB steps
+			linear interpolation, max error 0.01 swr to swr 10, 0.5% above
+errors and cost against the float path - hostTest/fastMathTest.cpp
+*/
+float log2Tab[LOG2_TAB_SIZE + 1];
+float swrTab[SWR_TAB_SIZE + 1];
+static_assert(SWR_TAB_SIZE * RL_TAB_STEP == RL_MAX, "RL_MAX must be a whole number of RL_TAB_STEP");
+
+
+/*----------------------------------- initFastMath() ------------------------------------
+builds lookup tables. called by setup()
+*/
+void initFastMath()
+{
+	// log2 of mantissa
+	for (int i = 0; i <= LOG2_TAB_SIZE; i++)
+		log2Tab[i] = log(1.0 + (float)i / LOG2_TAB_SIZE) / log(2.0);
+
+	// swr from return loss. rc = 10 ^ (-RL/20), swr = (1 + rc) / (1 - rc)
+	swrTab[0] = SWR_MAX;
+	for (int i = 1; i <= SWR_TAB_SIZE; i++)
+	{
+		float rc = pow(10.0, -i * RL_TAB_STEP / 20);
+		swrTab[i] = (1 + rc) / (1 - rc);
+	}
+}
+
+/*----------------------------------- fastLog10() ------------------------------------
+log10 from float exponent bits + mantissa table
+x must be > 0
+*/
+float fastLog10(float x)
+{
+	const int shift = 23 - LOG2_TAB_BITS;						// mantissa bits below table index
+	uint32_t bits;
+
+	memcpy(&bits, &x, sizeof(bits));							// float bit pattern
+	int e = (int)((bits >> 23) & 0xFF) - 127;					// unbiased exponent
+	uint32_t m = bits & 0x7FFFFF;								// 23 bit mantissa
+
+	// table index and interpolation fraction
+	int i = m >> shift;
+	float frac = (float)(m & ((1 << shift) - 1)) * (1.0 / (1 << shift));
+
+	float lg2 = e + log2Tab[i] + frac * (log2Tab[i + 1] - log2Tab[i]);
+	return lg2 * LOG10_2;
+}
+
+/*----------------------------------- fastDbm() ------------------------------------
+dBm = 10 * log10(1000 * watts), cannot be less than 0
+*/
+float fastDbm(float watts)
+{
+	if (watts <= 0.001)
+		return 0.0;
+	return 10 * fastLog10(watts) + 30;
+}
+
+/*----------------------------------- fastRetLoss() ------------------------------------
+return loss (dB) = 10 * log10(fwd / ref)
+returns RL_MAX for no reflected power
+*/
+float fastRetLoss(float fwd, float ref)
+{
+	if (ref <= 0)
+		return RL_MAX;
+
+	float rl = 10 * (fastLog10(fwd) - fastLog10(ref));
+	if (rl > RL_MAX)
+		rl = RL_MAX;
+	if (rl < 0)
+		rl = 0.0;
+	return rl;
+}
+
+/*----------------------------------- fastSwr() ------------------------------------
+swr from return loss (dB)
+high swr (rl < RL_TAB_MIN) is calculated, table is too coarse near swr = infinity
+*/
+float fastSwr(float rl)
+{
+	float swr;
+
+	if (rl < RL_TAB_MIN)
+	{
+		float rc = pow(10.0, -rl / 20);
+		if (rc >= 1.0)
+			return SWR_MAX;
+		swr = (1 + rc) / (1 - rc);
+	}
+	else
+	{
+		// table position, step is fixed so multiply, no division
+		float p = rl * (1.0 / RL_TAB_STEP);
+		int i = (int)p;
+		if (i >= SWR_TAB_SIZE)
+			return swrTab[SWR_TAB_SIZE];
+		swr = swrTab[i] + (p - i) * (swrTab[i + 1] - swrTab[i]);
+	}
+
+	if (swr > SWR_MAX)
+		swr = SWR_MAX;
+	if (swr < 1.0)
+		swr = 1.0;
+	return swr;
+}
+
+#endif
@@ -0,0 +1,69 @@
+// adcBufferTest.cpp - board profile and sample buffer, built for both boards
+// 1. board profile: buffer within RAM budget, fast profile does not average more than low noise
+// 2. averaging change restarts the averages from the new samples, old buffer contents not used
+// 3. averaging change costs about the same as any other sample, no buffer clear in the interrupt
+
+#include "sketch.cpp"
+#include "hostSim.cpp"
+#include <algorithm>
+#include <vector>
+
+double median(std::vector<double> v)
+{
+	std::sort(v.begin(), v.end());
+	return v[v.size() / 2];
+}
+
+int main()
+{
+	initADC();
+	initEnvStats();
+	initProtect();
+	hostRef = 0;
+
+	// 1. board profile
+	printf("%s: MAXBUF %d, buffer %u bytes, budget %lu bytes, averaging low noise %d fast %d\n",
+		adcMaxCode > 4095 ? "Teensy 3.2" : "Teensy 4.0", MAXBUF, (unsigned)((MAXBUF + 1) * sizeof(adcPair)), sampleRam,
+		adcProf[lowNoiseProf].averaging, adcProf[fastProf].averaging);
+	HOST_CHECK(adcProf[fastProf].averaging <= adcProf[lowNoiseProf].averaging, "fast profile averages more");
+
+	// 2. full 100% window at 2W, then 10% at 1W
+	unsigned int lo = pwrToCode(1), hi = pwrToCode(2);
+	samples = 100;
+	hostFwd = hi;
+	hostSampling(MAXBUF * 1000 / SAMPLE_FREQ + 100);
+	HOST_CHECK((unsigned int)a1Avg == hi, "100%% window average %ld, expected %u", a1Avg, hi);
+
+	samples = 10;
+	hostFwd = lo;
+	hostSampling(1);
+	HOST_CHECK((unsigned int)a1Avg == lo, "first average after change %ld, expected %u", a1Avg, lo);
+	hostSampling(MAXBUF / 10 * 1000 / SAMPLE_FREQ + 10);
+	HOST_CHECK((unsigned int)a1Avg == lo, "10%% window average %ld, expected %u", a1Avg, lo);
+
+	// back to 100%, old 2W samples still in the buffer must not be removed from the sums
+	samples = 100;
+	hostSampling(MAXBUF * 1000 / SAMPLE_FREQ * 3 / 2);
+	HOST_CHECK((unsigned int)a1Avg == lo, "100%% window average %ld after change, expected %u", a1Avg, lo);
+
+	// 3. getADC() cost, median of calls with and without an averaging change
+	const int n = 2000;
+	std::vector<double> sameNs, changeNs;
+	for (int i = 0; i < n; i++)
+	{
+		auto t0 = hostClk::now();
+		getADC();
+		sameNs.push_back(hostNs(t0, hostClk::now()));
+
+		samples = samples == 100 ? 50 : 100;
+		t0 = hostClk::now();
+		getADC();
+		changeNs.push_back(hostNs(t0, hostClk::now()));
+	}
+	double same = median(sameNs), change = median(changeNs);
+	printf("getADC() median %.0fns, with averaging change %.0fns\n", same, change);
+	HOST_CHECK(change < same + 1000, "averaging change %.0fns", change);
+
+	printf(hostFails ? "FAILED\n" : "passed\n");
+	return hostFails != 0;
+}
@@ -0,0 +1,84 @@
+// adcProfileTest.cpp - getADC() profile switching and averaging window
+// 1. profile switch decided on the samples just converted, not the averaging window
+// 2. averaging window time is the same in both profiles
+// 3. no step in the averages when the profile changes
+
+#include "sketch.cpp"
+#include "hostSim.cpp"
+
+// simulated mSecs until a1Avg reaches code, max 2 secs
+int settleMs(unsigned int code)
+{
+	for (int ms = 1; ms <= 2000; ms++)
+	{
+		hostSampling(1);
+		if ((unsigned int)a1Avg == code)
+			return ms;
+	}
+	return -1;
+}
+
+int main()
+{
+	initADC();
+	initEnvStats();
+	initProtect();
+	hostRef = 0;
+	samples = 75;											// calibration setting, longest window
+	const int windowMs = samples * MAXBUF / 100 * 1000 / SAMPLE_FREQ;
+	const int blockMs = (1 << PROF_BLOCK_BITS) * 1000 / SAMPLE_FREQ + 1;
+
+	// 1. step above PROF_UP_PWR - switch within one block, whatever the window
+	hostFwd = pwrToCode(1);
+	hostSampling(1000);
+	hostFwd = pwrToCode(PROF_UP_PWR * 2);
+	int ms = 0;
+	while (currProf == lowNoiseProf && ms < 2000)
+	{
+		hostSampling(1);
+		ms++;
+	}
+	printf("profile up after %dms, block %dms, window %dms\n", ms, blockMs, windowMs);
+	HOST_CHECK(ms <= blockMs, "profile switch %dms after step", ms);
+
+	// 2. window time - step within each profile
+	unsigned int lo1 = pwrToCode(1), lo2 = pwrToCode(2);
+	unsigned int hi1 = pwrToCode(PROF_UP_PWR * 2), hi2 = pwrToCode(PROF_UP_PWR * 3);
+	hostFwd = lo1;
+	hostSampling(1000);
+	HOST_CHECK(currProf == lowNoiseProf, "low noise profile at 1W");
+	hostFwd = lo2;
+	int loMs = settleMs(lo2);
+	hostFwd = hi1;
+	hostSampling(1000);
+	HOST_CHECK(currProf == fastProf, "fast profile at %.0fW", PROF_UP_PWR * 2);
+	hostFwd = hi2;
+	int hiMs = settleMs(hi2);
+	printf("window: low noise %dms, fast %dms, expected %dms\n", loMs, hiMs, windowMs);
+	HOST_CHECK(abs(loMs - windowMs) <= 1 && abs(hiMs - windowMs) <= 1, "window time changes with profile");
+
+	// 3. steady power either side of the switch levels - averages equal the input
+	// after the switch, no samples lost or counted twice
+	unsigned int mid = pwrToCode((PROF_UP_PWR + PROF_DOWN_PWR) / 2);
+	hostFwd = mid;
+	hostSampling(1000);
+	int prof = currProf;
+	unsigned int prevAvg = a1Avg;
+	bool isStep = false;
+	for (int i = 0; i < 4; i++)
+	{
+		// change profile with the same input
+		setAdcProfile(prof == lowNoiseProf ? fastProf : lowNoiseProf);
+		prof = currProf;
+		for (int t = 0; t < 100; t++)
+		{
+			hostSampling(1);
+			if ((unsigned int)a1Avg != prevAvg)
+				isStep = true;
+		}
+	}
+	HOST_CHECK(!isStep && prevAvg == mid, "average changed at profile switch, %u to %ld", mid, a1Avg);
+
+	printf(hostFails ? "FAILED\n" : "passed\n");
+	return hostFails != 0;
+}
@@ -0,0 +1,102 @@
+// fastMathTest.cpp - fastMath.ino error and cost against the float path in measure()
+// sweeps fastDbm(), fastRetLoss(), fastSwr() over the measure() input ranges
+// times are host nanosecs per call - relative cost only, Teensy 3.2 has no FPU
+
+#include "sketch.cpp"
+#include "hostSim.cpp"
+
+// float path, as measure() without FAST_MATH
+float floatDbm(float watts)
+{
+	float dB = 10 * log10(watts * 1000);
+	if (dB < 0)
+		dB = 0.0;
+	return dB;
+}
+
+void floatSwr(float fwd, float ref, float* swr, float* rl)
+{
+	float rc = sqrt(ref / fwd);
+	*swr = (1 + rc) / (1 - rc);
+	if (*swr <= 1.0)
+		*swr = 1.0;
+	if (*swr > SWR_MAX)
+		*swr = SWR_MAX;
+	*rl = RL_MAX;
+	if (rc > 0)
+		*rl = -20 * log10(rc);
+	if (*rl > RL_MAX)
+		*rl = RL_MAX;
+}
+
+template<class F> double nsPerCall(int n, F f)
+{
+	auto t0 = hostClk::now();
+	for (int i = 0; i < n; i++)
+		f(i);
+	return hostNs(t0, hostClk::now()) / n;
+}
+
+volatile float sink;
+
+int main()
+{
+	initFastMath();
+	const int steps = 200000;
+
+	// dBm, 1 mW to 2 kW
+	double dbmErr = 0;
+	for (int i = 0; i <= steps; i++)
+	{
+		float w = 0.0011 * pow(2000 / 0.0011, (double)i / steps);
+		dbmErr = max(dbmErr, fabs((double)fastDbm(w) - floatDbm(w)));
+	}
+
+	// return loss and swr, fwd 1 - 1500 W, swr 1.0 to SWR_MAX
+	// swr error is checked to display resolution (0.1) up to swr 10, relative above that
+	double rlErr = 0, swrErr = 0, swrRelErr = 0;
+	for (int f = 0; f <= 100; f++)
+	{
+		float fwd = pow(1500.0, f / 100.0);
+		for (int i = 1; i <= steps / 100; i++)
+		{
+			float rl = RL_MAX * i / (steps / 100) + 0.001;
+			float ref = fwd * pow(10.0, -rl / 10);
+			float swr, rlF;
+			floatSwr(fwd, ref, &swr, &rlF);
+			float rlFast = fastRetLoss(fwd, ref);
+			float swrFast = fastSwr(rlFast);
+			rlErr = max(rlErr, fabs((double)rlFast - rlF));
+			if (swr <= 10)
+				swrErr = max(swrErr, fabs((double)swrFast - swr));
+			else
+				swrRelErr = max(swrRelErr, fabs((double)swrFast - swr) / swr);
+		}
+	}
+
+	printf("max error: dBm %.5f dB, return loss %.5f dB, swr %.4f (swr <= 10), %.3f%% (swr > 10)\n",
+		dbmErr, rlErr, swrErr, swrRelErr * 100);
+	HOST_CHECK(dbmErr < 0.005, "dBm error %f", dbmErr);
+	HOST_CHECK(rlErr < 0.005, "return loss error %f", rlErr);
+	HOST_CHECK(swrErr < 0.01, "swr error %f", swrErr);
+	HOST_CHECK(swrRelErr < 0.005, "swr relative error %f", swrRelErr);
+
+	// limits
+	HOST_CHECK(fastDbm(0) == 0 && fastDbm(0.0005) == 0, "dBm below 1 mW");
+	HOST_CHECK(fastRetLoss(100, 0) == RL_MAX, "return loss, no reflected");
+	HOST_CHECK(fastRetLoss(100, 200) == 0, "return loss, ref > fwd");
+	HOST_CHECK(fastSwr(0) == (float)SWR_MAX, "swr, rl = 0");
+	HOST_CHECK(fastSwr(RL_MAX) < 1.01, "swr, rl = RL_MAX");
+
+	// cost, measure() inputs
+	const int n = 2000000;
+	double tDbm = nsPerCall(n, [](int i) { sink = floatDbm(1 + (i & 1023)); });
+	double tDbmFast = nsPerCall(n, [](int i) { sink = fastDbm(1 + (i & 1023)); });
+	double tSwr = nsPerCall(n, [](int i) { float s, r; floatSwr(100, 1 + (i & 63), &s, &r); sink = s + r; });
+	double tSwrFast = nsPerCall(n, [](int i) { float r = fastRetLoss(100, 1 + (i & 63)); sink = fastSwr(r) + r; });
+	printf("host ns/call: dBm float %.1f fast %.1f, swr + return loss float %.1f fast %.1f\n",
+		tDbm, tDbmFast, tSwr, tSwrFast);
+
+	printf(hostFails ? "FAILED\n" : "passed\n");
+	return hostFails != 0;
+}
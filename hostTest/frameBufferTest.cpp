@@ -0,0 +1,85 @@
+// frameBufferTest.cpp - frame buffer and direct drawing give the same panel image
+// hostTest.sh builds this twice, with and without FRAME_BUFFER, and compares the
+// "panel" lines. Each is printed after updateDisplay(true), a complete frame.
+// frame buffer build also checks: no DMA when nothing drawn, buffers equal after update
+
+#include "sketch.cpp"
+#include "hostSim.cpp"
+
+int checkpoint = 0;
+
+void panel(const char* what)
+{
+	updateDisplay(true);
+	printf("panel %2d %08x  %s\n", checkpoint++, hostPanelHash(), what);
+#ifdef FRAME_BUFFER
+	HOST_CHECK(memcmp(tftBuff[0], tftBuff[1], sizeof(tftBuff[0])) == 0, "buffers differ after update, %s", what);
+#endif
+}
+
+int main()
+{
+	hostRadioOn();
+	setup();
+	panel("setup");
+
+	hostDelay = hostSampling;
+	hostRef = 0;
+	hostFwd = 0;
+
+	// power levels through measure(), values and meters
+	static int step = 0;
+	static const float pwr[] = { 5, 20, 60, 100, 35, 0 };
+	static uint64_t stepMicros = simMicros;
+	hostAnalogRead = [] {
+		hostSampling(1);
+		if (simMicros - stepMicros > 300000 && step < 5)
+		{
+			step++;
+			stepMicros = simMicros;
+			float p = pwr[step];
+			hostFwd = p > 0 ? pwrToCode(p) : 0;
+			hostRef = p > 0 ? refPwrToCode(p / 20) : 0;
+			panel("power step");
+		}
+	};
+	hostFwd = pwrToCode(pwr[0]);
+	hostRun(3000);
+	panel("power off");
+
+	// envelope statistics in place of meter
+	statsButton(netPwrMeter);
+	hostRun(1000);
+	panel("statistics");
+	statsButton(pkAvgRatio);
+	hostRun(500);
+	panel("meter restored");
+
+	// options screen open and closed
+	optViewOpen(avgView);
+	hostRun(500);
+	panel("options open");
+	optViewClose();
+	hostRun(500);
+	panel("options closed");
+
+	// basic layout
+	isCivEnable = false;
+	initDisplay();
+	hostRun(500);
+	panel("basic layout");
+
+	// idle, only heartbeat drawn - DMA for heartbeat changes only
+	hostRun(IDLE_DELAY + 500);
+	int dma = hostDmaCount;
+	hostRun(5000);
+#ifdef FRAME_BUFFER
+	dma = hostDmaCount - dma;
+	printf("idle 5 secs: %d DMA updates\n", dma);
+	HOST_CHECK(dma <= 5000 / 500 + 1, "%d DMA updates with nothing drawn", dma);
+#endif
+	panel("end");
+
+	printf(hostFails ? "FAILED\n" : "passed\n");
+	return hostFails != 0;
+}
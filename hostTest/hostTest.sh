@@ -0,0 +1,64 @@
+#!/bin/bash
+# hostTest.sh - builds and runs the host tests on a PC, no Teensy needed
+# the sketch is joined like the Arduino builder (main .ino, then the others
+# in name order, with function prototypes) and built against the stubs in stubs/
+#
+# usage: hostTest/hostTest.sh [test name ...]     default: all tests
+set -e -o pipefail
+here=$(cd "$(dirname "$0")" && pwd)
+sketch=$(cd "$here/.." && pwd)
+build=$here/_build
+mkdir -p "$build"
+
+main=PowerMeter-CIVController.ino
+others=$(cd "$sketch" && ls *.ino | grep -v "^$main$" | LC_ALL=C sort)
+
+# prototypes for top level function definitions
+protos=$(cd "$sketch" && cat $main $others | iconv -f latin1 -t utf-8 \
+	| grep -E '^(void|int|float|bool|char|long|unsigned|double|uint[0-9]+_t|int[0-9]+_t)( (int|long|char))?[ \*]+[a-zA-Z_][a-zA-Z0-9_]*\([^;]*\)\s*(//.*)?$' \
+	| sed -E 's#\s*//.*$##; s/\s+$//; s/$/;/; s/= *[^,)]+//g')
+
+{
+	cd "$sketch"
+	awk '/^void setup\(\)/{exit} {print}' $main
+	echo "$protos"
+	awk '/^void setup\(\)/{p=1} p{print}' $main
+	for f in $others; do echo; echo "#line 1 \"$f\""; cat $f; done
+} | iconv -f latin1 -t utf-8 -c > "$build/sketch.cpp"
+
+CXX=${CXX:-g++}
+FLAGS="-std=gnu++14 -O2 -funsigned-char -I$here/stubs -I$sketch -I$build"
+
+# build and run one test: name, output file, extra flags
+run()
+{
+	local name=$1 out=$2
+	shift 2
+	$CXX $FLAGS "$@" -include Arduino.h -o "$build/$out" "$here/$name.cpp" || return 1
+	echo "---- $out"
+	"$build/$out"
+}
+
+tests=${@:-$(cd "$here" && ls *Test.cpp *Bench.cpp | sed "s/\.cpp$//")}
+fail=0
+for t in $tests; do
+	case $t in
+	adcBufferTest)
+		# both board profiles
+		run $t ${t}T32 || fail=1
+		run $t ${t}T40 -DTEENSY40 -D__IMXRT1062__ || fail=1 ;;
+	frameBufferTest)
+		# same drawing, direct and frame buffer builds, panel images must match
+		run $t ${t}Direct -DTEENSY40 -D__IMXRT1062__ | tee "$build/$t.direct" || fail=1
+		run $t ${t}Buffer -DTEENSY40 -D__IMXRT1062__ -DFRAME_BUFFER | tee "$build/$t.buffer" || fail=1
+		if diff <(grep "^panel" "$build/$t.direct") <(grep "^panel" "$build/$t.buffer"); then
+			echo "panel images match"
+		else
+			echo "FAIL panel images differ"
+			fail=1
+		fi ;;
+	*)
+		run $t $t || fail=1 ;;
+	esac
+done
+exit $fail
@@ -0,0 +1,53 @@
+// idleWakeTest.cpp - idle mode wake from power on
+// 1. waking sample counted once by envelope statistics
+// 2. wake latency recorded at first net power display above threshold
+
+#include "sketch.cpp"
+#include "hostSim.cpp"
+
+int main()
+{
+	setup();
+	hostRef = 0;
+	hostFwd = 0;
+
+	// loop() with sampling between passes, and while measure() loops with power on
+	hostAnalogRead = [] { hostSampling(1); };
+	// idle delay from end of setup, averaging window filled before idle
+	idleReset();
+	hostRun(IDLE_DELAY + 500);
+	HOST_CHECK(isIdle, "not idle after IDLE_DELAY");
+
+	// 1. one sample above threshold wakes, counted once at the profile sample rate
+	uint32_t keyed = statsKeyed;
+	hostAdcFwd = pwrToCode(5);								// low noise profile, raw code = code
+	getADC();
+	HOST_CHECK(!isIdle, "no wake on power");
+	printf("waking sample counted %u, expected %d\n", statsKeyed - keyed, STATS_FREQ / SAMPLE_FREQ);
+	HOST_CHECK(statsKeyed - keyed == STATS_FREQ / SAMPLE_FREQ, "waking sample counted %u", statsKeyed - keyed);
+
+	// back to idle, previous wake was not displayed above threshold and is dropped
+	hostFwd = 0;
+	hostRun(IDLE_DELAY + 500);
+	HOST_CHECK(isIdle && wakeCount == 0, "idle again, wakes %u", wakeCount);
+
+	// 2. key up just above threshold, average takes most of the window to reach threshold
+	// latency is to that display, not to the first measure() pass
+	int windowUs = samples * MAXBUF / 100 * (1000000 / SAMPLE_FREQ);
+	// power off after 2 windows, measure() returns when the average drops
+	static uint64_t offMicros = simMicros + 2 * windowUs;
+	hostAnalogRead = [] {
+		hostSampling(1);
+		if (simMicros > offMicros)
+			hostFwd = 0;
+	};
+	hostFwd = pwrToCode(PWR_THRESHOLD * 1.2);
+	hostRun(4 * windowUs / 1000);
+	printf("wake latency %luus, window %dus, wakes %u\n", wakeLatency, windowUs, wakeCount);
+	HOST_CHECK(wakeCount == 1, "wakes %u", wakeCount);
+	HOST_CHECK(wakeLatency > (unsigned long)windowUs / 2 && wakeLatency <= (unsigned long)windowUs + 5000,
+		"latency %lu, not at first display above threshold", wakeLatency);
+
+	printf(hostFails ? "FAILED\n" : "passed\n");
+	return hostFails != 0;
+}
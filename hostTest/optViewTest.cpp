@@ -0,0 +1,115 @@
+// optViewTest.cpp - options screen is not modal
+// 1. autoband countdown runs and changes band with the options screen open
+// 2. hidden main screen frames do not draw over the options screen
+// 3. More.. / Exit between screens disables the previous screen frames
+// 4. exit unhides the main screen, options frames disabled
+// 5. every options layout draws over the main screen frames, exit redraw is not wasted
+
+#include "sketch.cpp"
+#include "hostSim.cpp"
+
+// options pixels in area, not background
+int optPixels(int x, int y, int w, int h)
+{
+	int n = 0;
+	for (int row = y; row < y + h; row++)
+		for (int col = x; col < x + w; col++)
+			n += hostPanel[row * HOST_TFT_W + col] != BG_COLOUR;
+	return n;
+}
+
+// open view, count main screen frames under options drawing
+// frames not drawn over are allowed only if redrawn by the view Exit anyway
+void optCover(const char* layout, int view, int exitRedraw)
+{
+	int numFrames = sizeof(fr) / sizeof(frame);
+	bool isMain[MAX_FRAMES];
+	for (int i = 0; i < numFrames; i++)
+		isMain[i] = fr[i].isEnable;
+
+	optViewOpen(view);
+	int frames = 0, covered = 0, outside = optPixels(0, 0, HOST_TFT_W, HOST_TFT_H);
+	for (int i = 0; i < numFrames; i++)
+	{
+		if (!isMain[i])
+			continue;
+		int n = optPixels(fr[i].x, fr[i].y, fr[i].w, fr[i].h);
+		frames++;
+		covered += n > 0;
+		outside -= n;
+		HOST_CHECK(n > 0 || i == exitRedraw, "%s view %d: frame %d not drawn over", layout, view, i);
+	}
+	printf("%s view %d: %d of %d main screen frames drawn over, %d options pixels between frames\n", layout, view, covered, frames, outside);
+	HOST_CHECK(outside > 0, "%s view %d: no options pixels between frames", layout, view);
+	optViewClose();
+}
+
+int main()
+{
+	hostRadioOn();
+	setup();
+	HOST_CHECK(isCivEnable, "radio not found");
+
+	hostFwd = 0;
+	hostRef = 0;
+	hostDelay = hostSampling;
+
+	// autoband on at 20m, next band 17m
+	hfBand[5].isABand = true;
+	hfBand[6].isABand = true;
+	optABand.val = 15;
+	lab[aBand].stat = false;
+	aBandButton(SHORTTOUCH);
+	HOST_CHECK(lab[aBand].stat, "autoband not started");
+
+	// long touch on ABand opens options
+	aBandButton(LONGTOUCH);
+	HOST_CHECK(optView == tuneABandView, "options not open");
+	HOST_CHECK(fr[aBand].isEnable && fr[tuner].isEnable && fr[freqTune].isEnable, "main screen frames disabled");
+	hostRun(1000);
+	uint32_t menu = hostPanelHash();
+
+	// 1, 2. countdown and band change, screen unchanged
+	int writes = hostRadio.freqWrites;
+	int redraws = 0;
+	for (int t = 0; t < (optABand.val + 3) * 10; t++)
+	{
+		hostRun(100);
+		redraws += hostPanelHash() != menu;
+	}
+	printf("options open %ds: %d frequency writes, radio at %ld Hz\n", optABand.val + 3, hostRadio.freqWrites - writes, hostRadio.freqHz);
+	HOST_CHECK(hostRadio.freqWrites > writes && hostRadio.freqHz == 18100000, "no band change with options open");
+	HOST_CHECK(currBand == 6, "band %d not followed", currBand);
+	HOST_CHECK(redraws == 0, "options screen overdrawn %d times", redraws);
+
+	// 3. More.. then Exit back
+	optViewOpen(tuneTimeView);
+	HOST_CHECK(fr[freqTuneOpt].isEnable && !fr[freqTuneOpt].isHide, "time options frame not shown");
+	optViewOpen(tuneABandView);
+	HOST_CHECK(!fr[freqTuneOpt].isEnable && !fr[aBandTimeOpt].isEnable, "time options frames left enabled");
+	HOST_CHECK(fr[aBand].isEnable && fr[aBand].isHide, "main screen frame not hidden");
+
+	// 4. exit
+	optViewClose();
+	int numFrames = sizeof(fr) / sizeof(frame);
+	bool isHide = false;
+	for (int i = 0; i < numFrames; i++)
+		isHide |= fr[i].isHide;
+	HOST_CHECK(optView == noView && !isHide, "frames hidden after exit");
+	HOST_CHECK(!fr[stripPwr].isEnable && !fr[stripSwr].isEnable, "options frames left enabled");
+	HOST_CHECK(fr[aBand].isEnable && lab[aBand].stat, "autoband stopped");
+
+	// 5. options cover the main screen - exit redraws all frames and clears between them
+	// averaging Exit relabels the avgOptions button, see avgOptsTouch()
+	// time options Exit returns to the tuner / autoband screen, not the main screen
+	lab[aBand].stat = false;
+	optCover("C-IV", avgView, avgOptions);
+	optCover("C-IV", tuneABandView, -1);
+	optCover("C-IV", tuneTimeView, avgOptions);
+	copyFrame(basicFrame, sizeof(basicFrame) / sizeof(frame));
+	drawDisplay();
+	optCover("basic", avgView, avgOptions);
+
+	printf(hostFails ? "FAILED\n" : "passed\n");
+	return hostFails != 0;
+}
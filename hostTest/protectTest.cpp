@@ -0,0 +1,97 @@
+// protectTest.cpp - swr protection trip path with a simulated radio
+// 1. radio power cache keeps the last good level on a bad C-IV reply
+// 2. power level is refreshed every TX_PWR_POLL with spectrum ref shown, not every loop()
+// 3. no trip at low power, no reflected
+// 4. fault to power cut on the wire, restore on acknowledge
+// 5. power cut C-IV write fails - not cut, tried again next pass
+
+#include "sketch.cpp"
+#include "hostSim.cpp"
+
+int main()
+{
+	hostRadioOn();
+	setup();
+	HOST_CHECK(isCivEnable, "radio not found");
+	HOST_CHECK(txPwrLevel == hostRadio.pwr, "power level not read at start, %d", txPwrLevel);
+
+	// 1. bad reply
+	hostRadio.isBadReply = true;
+	int pwr = getTxPwr();
+	HOST_CHECK(pwr == 128 && txPwrLevel == 128, "bad reply, power %d cached %d", pwr, txPwrLevel);
+
+	// sampling runs through delays and while measure() loops
+	hostRef = 0;
+	hostFwd = 0;
+	hostDelay = hostSampling;
+	hostAnalogRead = [] { hostSampling(1); };
+
+	// 2. spectrum ref shown in place of power
+	eraseFrame(txPwr);
+	restoreFrame(sRef);
+	int reads = hostRadio.pwrReads;
+	int passes = hostRun(10000);
+	reads = hostRadio.pwrReads - reads;
+	printf("spectrum ref shown: %d loop passes, %d power reads in 10s\n", passes, reads);
+	HOST_CHECK(reads <= 10000 / TX_PWR_POLL + 1, "power read %d times", reads);
+
+	// 3. just above threshold, no reflected
+	static uint64_t offMicros = simMicros + 1000000;
+	hostAnalogRead = [] {
+		hostSampling(1);
+		if (simMicros > offMicros)
+			hostFwd = 0;
+	};
+	hostFwd = pwrToCode(PWR_THRESHOLD * 1.5);
+	hostRun(1500);
+	HOST_CHECK(!isTrip, "trip at low power, no reflected");
+
+	// 4. fault at 100W, swr 5, longest averaging window
+	// radio power cut ends the fault
+	samples = 75;
+	hostRun(500);
+	float rc = (5.0 - 1) / (5.0 + 1);
+	hostAnalogRead = [] {
+		hostSampling(1);
+		if (hostRadio.pwr == 0)
+		{
+			hostFwd = 0;
+			hostRef = 0;
+		}
+	};
+	uint64_t faultMicros = simMicros;
+	hostRadio.pwrWriteMicros = 0;
+	hostFwd = pwrToCode(100);
+	hostRef = refPwrToCode(100 * rc * rc);
+	hostRun(2000);
+
+	const int blockUs = (1 << PROF_BLOCK_BITS) * 1000000 / SAMPLE_FREQ;
+	unsigned long wireUs = hostRadio.pwrWriteMicros - faultMicros;
+	printf("fault to power cut on the wire %luus, trip to wire %luus, block %dus\n", wireUs, tripLatency, blockUs);
+	HOST_CHECK(hostRadio.pwrWriteMicros != 0 && hostRadio.pwr == 0, "radio power not cut");
+	HOST_CHECK(isTrip && isTripCut, "trip not latched");
+	HOST_CHECK(wireUs <= (TRIP_BLOCKS + 1) * blockUs + 50000, "fault to cut %luus", wireUs);
+
+	// acknowledge restores last good level
+	protectAck();
+	HOST_CHECK(hostRadio.pwr == 128 && !isTrip, "restored power %d", hostRadio.pwr);
+
+	// 5. trip with the power write lost on the bus
+	hostAnalogRead = nullptr;
+	hostFwd = 0;
+	hostRef = 0;
+	noInterrupts();
+	isTrip = true;
+	tripMicros = micros();
+	interrupts();
+	hostRadio.busyWrites = 1;
+	protectMain();
+	HOST_CHECK(!isTripCut && hostRadio.pwr == 128, "power write failed, cut %d, radio power %d", isTripCut, hostRadio.pwr);
+	protectMain();
+	HOST_CHECK(isTripCut && hostRadio.pwr == 0, "power not cut on next pass, radio power %d", hostRadio.pwr);
+	protectAck();
+	HOST_CHECK(hostRadio.pwr == 128, "restored power %d after failed write", hostRadio.pwr);
+
+	printf(hostFails ? "FAILED\n" : "passed\n");
+	return hostFails != 0;
+}
@@ -0,0 +1,27 @@
+// ADC.h - host test stub
+// analogSyncRead() returns hostAdcFwd, hostAdcRef, settings are recorded
+#pragma once
+#include <Arduino.h>
+
+enum class ADC_CONVERSION_SPEED { VERY_LOW_SPEED, LOW_SPEED, MED_SPEED, HIGH_SPEED, VERY_HIGH_SPEED, HIGH_SPEED_16BITS, ADACK_2_4, ADACK_4_0, ADACK_5_2, ADACK_6_2 };
+enum class ADC_SAMPLING_SPEED { VERY_LOW_SPEED, LOW_SPEED, MED_SPEED, HIGH_SPEED, VERY_HIGH_SPEED };
+
+extern int hostAdcFwd, hostAdcRef;						// next sync read result
+extern void (*hostAnalogRead)();						// called by analogRead(), eg to run getADC()
+
+struct ADC_Module {
+	int averaging = 0, resolution = 16;
+	void setAveraging(uint8_t n) { averaging = n; }
+	void setResolution(uint8_t n) { resolution = n; }
+	void setConversionSpeed(ADC_CONVERSION_SPEED) {}
+	void setSamplingSpeed(ADC_SAMPLING_SPEED) {}
+	uint32_t getMaxValue() { return (1u << resolution) - 1; }
+};
+
+struct ADC {
+	struct Sync_result { int32_t result_adc0, result_adc1; };
+	ADC_Module* adc0 = new ADC_Module;
+	ADC_Module* adc1 = new ADC_Module;
+	int analogRead(int) { if (hostAnalogRead) hostAnalogRead(); return 0; }
+	Sync_result analogSyncRead(int, int) { return { hostAdcRef, hostAdcFwd }; }
+};
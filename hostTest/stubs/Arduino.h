@@ -0,0 +1,125 @@
+// Arduino.h - host test stub
+// simulated clock, pins, serial ports for building the sketch on a PC
+// see hostTest.sh
+
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <cstdarg>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include <deque>
+#include <vector>
+#include <functional>
+#include <string>
+using std::isnan; using std::isnormal; using std::min; using std::max;
+
+typedef uint8_t byte;
+#define HIGH			1
+#define LOW				0
+#define OUTPUT			1
+#define INPUT			0
+#define LED_BUILTIN		13
+#define A14				40
+#define DEC				10
+#define HEX				16
+#define B0101001		0x29				// binary.h constant used by eeProm.ino
+#define DMAMEM
+#define FASTRUN
+#define constrain(a, l, h)	((a) < (l) ? (l) : ((a) > (h) ? (h) : (a)))
+#define abs(x)				((x) > 0 ? (x) : -(x))
+
+/*------  simulated clock ----------------------------------*/
+// every read of the clock advances it one microsec, so busy waits end
+// hostDelay, if set, passes the time instead of delay(), eg sampling
+extern uint64_t simMicros;
+extern void (*hostDelay)(unsigned long ms);
+inline unsigned long micros()				{ return (unsigned long)(simMicros++); }
+inline unsigned long millis()				{ return (unsigned long)(simMicros++ / 1000); }
+inline void delay(unsigned long ms)			{ if (hostDelay) hostDelay(ms); else simMicros += ms * 1000; }
+inline void delayMicroseconds(unsigned us)	{ simMicros += us; }
+
+/*------  pins, interrupts ---------------------------------*/
+inline void pinMode(int, int) {}
+inline void digitalWrite(int, int) {}
+inline void digitalWriteFast(int, int) {}
+inline int digitalRead(int) { return 0; }
+inline void analogWrite(int, int) {}
+inline void noInterrupts() {}
+inline void interrupts() {}
+inline long map(long x, long a, long b, long c, long d) { return (x - a) * (d - c) / (b - a) + c; }
+
+struct IntervalTimer {
+	bool begin(void(*)(), float) { return true; }
+	void update(float) {}
+	void end() {}
+	void priority(int) {}
+};
+
+/*------  Print - formats to write() -----------------------*/
+struct Print {
+	virtual ~Print() {}
+	virtual size_t write(uint8_t) { return 1; }
+	size_t write(const char* s) { size_t n = 0; while (*s) n += write((uint8_t)*s++); return n; }
+	int printf(const char* fmt, ...)
+	{
+		char buff[512];
+		va_list ap;
+		va_start(ap, fmt);
+		int n = vsnprintf(buff, sizeof(buff), fmt, ap);
+		va_end(ap);
+		write(buff);
+		return n;
+	}
+	size_t print(const char* s)				{ return write(s); }
+	size_t print(char c)					{ return write((uint8_t)c); }
+	size_t print(float f, int d = 2)		{ return printf("%.*f", d, f); }
+	size_t print(double f, int d = 2)		{ return printf("%.*f", d, f); }
+	size_t print(int n, int base = DEC)		{ return printf(base == HEX ? "%X" : "%d", n); }
+	size_t print(unsigned n, int b = DEC)	{ return printf(b == HEX ? "%X" : "%u", n); }
+	size_t print(long n, int base = DEC)	{ return printf(base == HEX ? "%lX" : "%ld", n); }
+	size_t print(unsigned long n, int b = DEC)	{ return printf(b == HEX ? "%lX" : "%lu", n); }
+	template<class T> size_t println(T t)			{ size_t n = print(t); return n + println(); }
+	template<class T> size_t println(T t, int d)	{ size_t n = print(t, d); return n + println(); }
+	size_t println()						{ return write((uint8_t)'\n'); }
+};
+
+/*------  serial ports -------------------------------------*/
+// Serial prints to stdout when hostSerialOut is set
+// Serial1 (C-IV) echoes writes like the CI-V bus, civRadio is called with each frame
+struct HardwareSerial : Print {
+	std::deque<uint8_t> rx;								// bytes waiting to be read
+	std::vector<uint8_t> frame;							// bytes written since last 0xFD
+	bool isEcho = false;
+	bool isStdout = false;
+	std::string text;									// everything written
+	std::function<void(HardwareSerial&, const std::vector<uint8_t>&)> onFrame;
+	std::function<void(HardwareSerial&)> onFlush;			// civWrite() start
+	void begin(long) {}
+	int available() { return rx.size(); }
+	int read() { if (rx.empty()) return -1; int c = rx.front(); rx.pop_front(); return c; }
+	void flush() { if (onFlush) onFlush(*this); }
+	explicit operator bool() { return true; }
+	using Print::write;
+	size_t write(uint8_t c) override
+	{
+		text += (char)c;
+		if (isStdout)
+			putchar(c);
+		if (isEcho)
+		{
+			rx.push_back(c);
+			frame.push_back(c);
+			if (c == 0xFD)
+			{
+				if (onFrame)
+					onFrame(*this, frame);
+				frame.clear();
+			}
+		}
+		return 1;
+	}
+};
+extern HardwareSerial Serial, Serial1, Serial3;
@@ -0,0 +1,13 @@
+// EEPROM.h - host test stub, in memory
+#pragma once
+#include <Arduino.h>
+
+struct EEPROMClass {
+	uint8_t mem[2048] = {};
+	template<class T> T& get(int a, T& t) { memcpy((void*)&t, mem + a, sizeof(T)); return t; }
+	template<class T> const T& put(int a, const T& t) { memcpy(mem + a, (const void*)&t, sizeof(T)); return t; }
+	uint8_t read(int a) { return mem[a]; }
+	void write(int a, uint8_t v) { mem[a] = v; }
+	int length() { return sizeof(mem); }
+};
+extern EEPROMClass EEPROM;
@@ -0,0 +1,99 @@
+// ILI9341_t3.h - host test stub
+// draws into a 320x240 panel image, so direct and frame buffer builds can be compared
+// shapes and text are simplified, but both builds draw with the same code
+#pragma once
+#include <Arduino.h>
+
+struct ILI9341_t3_font_t { int cap_height; int line_space; };
+
+#define HOST_TFT_W		320
+#define HOST_TFT_H		240
+extern uint16_t hostPanel[HOST_TFT_W * HOST_TFT_H];		// pixels on the display
+
+struct ILI9341_t3 : Print {
+	int16_t _width = HOST_TFT_W, _height = HOST_TFT_H;
+	int16_t cursor_x = 0, cursor_y = 0;
+	uint16_t textcolor = 0xFFFF, textbgcolor = 0;
+	bool isTextBg = false;
+	const ILI9341_t3_font_t* font = nullptr;
+
+	ILI9341_t3(int, int, int = 255, int = 11, int = 13, int = 12) {}
+	virtual ~ILI9341_t3() {}
+	void begin() {}
+	void setRotation(int) {}
+	int16_t width() { return _width; }
+	int16_t height() { return _height; }
+
+	// pixel destination, frame buffer in ILI9341_t3n
+	virtual void plot(int x, int y, uint16_t c) { hostPanel[y * HOST_TFT_W + x] = c; }
+	void pixel(int x, int y, uint16_t c)
+	{
+		if (x >= 0 && y >= 0 && x < _width && y < _height)
+			plot(x, y, c);
+	}
+
+	void fillRect(int x, int y, int w, int h, uint16_t c)
+	{
+		for (int j = y; j < y + h; j++)
+			for (int i = x; i < x + w; i++)
+				pixel(i, j, c);
+	}
+	void drawRect(int x, int y, int w, int h, uint16_t c)
+	{
+		drawFastHLine(x, y, w, c); drawFastHLine(x, y + h - 1, w, c);
+		drawFastVLine(x, y, h, c); drawFastVLine(x + w - 1, y, h, c);
+	}
+	void drawFastVLine(int x, int y, int h, uint16_t c) { fillRect(x, y, 1, h, c); }
+	void drawFastHLine(int x, int y, int w, uint16_t c) { fillRect(x, y, w, 1, c); }
+	void fillScreen(uint16_t c) { fillRect(0, 0, _width, _height, c); }
+	void fillRectVGradient(int x, int y, int w, int h, uint16_t c1, uint16_t c2)
+	{
+		fillRect(x, y, w, h / 2, c1);
+		fillRect(x, y + h / 2, w, h - h / 2, c2);
+	}
+	void fillScreenVGradient(uint16_t c1, uint16_t c2) { fillRectVGradient(0, 0, _width, _height, c1, c2); }
+	void fillRoundRect(int x, int y, int w, int h, int, uint16_t c) { fillRect(x, y, w, h, c); }
+	void drawRoundRect(int x, int y, int w, int h, int, uint16_t c) { drawRect(x, y, w, h, c); }
+	void fillCircle(int x0, int y0, int r, uint16_t c)
+	{
+		for (int j = -r; j <= r; j++)
+			for (int i = -r; i <= r; i++)
+				if (i * i + j * j <= r * r)
+					pixel(x0 + i, y0 + j, c);
+	}
+	void drawCircle(int x0, int y0, int r, uint16_t c)
+	{
+		for (int j = -r; j <= r; j++)
+			for (int i = -r; i <= r; i++)
+				if (abs(i * i + j * j - r * r) <= r)
+					pixel(x0 + i, y0 + j, c);
+	}
+
+	// text - each character a patterned box, width from font height
+	void setCursor(int x, int y) { cursor_x = x; cursor_y = y; }
+	void setFont(const ILI9341_t3_font_t& f) { font = &f; }
+	void setTextColor(uint16_t c) { textcolor = c; isTextBg = false; }
+	void setTextColor(uint16_t c, uint16_t bg) { textcolor = c; textbgcolor = bg; isTextBg = true; }
+	int charWidth() { return font ? font->cap_height * 6 / 10 + 1 : 6; }
+	int charHeight() { return font ? font->cap_height : 8; }
+	int strPixelLen(const char* s) { return strlen(s) * charWidth(); }
+	using Print::write;
+	size_t write(uint8_t c) override
+	{
+		if (c == '\n')
+		{
+			cursor_x = 0;
+			cursor_y += font ? font->line_space : 10;
+			return 1;
+		}
+		int w = charWidth(), h = charHeight();
+		for (int j = 0; j < h; j++)
+			for (int i = 0; i < w - 1; i++)
+				if ((i * 7 + j * 3 + c) % 5 == 0)
+					pixel(cursor_x + i, cursor_y + j, textcolor);
+				else if (isTextBg)
+					pixel(cursor_x + i, cursor_y + j, textbgcolor);
+		cursor_x += w;
+		return 1;
+	}
+};
@@ -0,0 +1,48 @@
+// ILI9341_t3n.h - host test stub
+// frame buffer drawing with changed area tracking, as ILI9341_t3n
+// updateScreenAsync() sends the whole frame buffer to the panel and completes at once
+#pragma once
+#include <ILI9341_t3.h>
+
+extern int hostDmaCount;								// updateScreenAsync() calls
+
+struct ILI9341_t3n : ILI9341_t3 {
+	ILI9341_t3n(int a, int b) : ILI9341_t3(a, b) { clearChangedRange(); }
+	void setFrameBuffer(uint16_t* fb) { _pfbtft = fb; }
+	uint8_t useFrameBuffer(bool b) { _use_fbtft = b; return 1; }
+	void updateChangedAreasOnly(bool b) { _updateChangedAreasOnly = b; }
+	bool asyncUpdateActive() { return false; }
+	void waitUpdateAsyncComplete() {}
+	bool updateScreenAsync(bool = false)
+	{
+		memcpy(hostPanel, _pfbtft, sizeof(hostPanel));
+		hostDmaCount++;
+		return true;
+	}
+	void plot(int x, int y, uint16_t c) override
+	{
+		if (!_use_fbtft)
+		{
+			ILI9341_t3::plot(x, y, c);
+			return;
+		}
+		_pfbtft[y * _width + x] = c;
+		if (x < _changed_min_x) _changed_min_x = x;
+		if (x > _changed_max_x) _changed_max_x = x;
+		if (y < _changed_min_y) _changed_min_y = y;
+		if (y > _changed_max_y) _changed_max_y = y;
+	}
+
+protected:
+	uint16_t* _pfbtft = nullptr;
+	uint8_t _use_fbtft = 0;
+	bool _updateChangedAreasOnly = false;
+	int16_t _changed_min_x, _changed_max_x, _changed_min_y, _changed_max_y;
+	void clearChangedRange()
+	{
+		_changed_min_x = 0x7fff;
+		_changed_max_x = -1;
+		_changed_min_y = 0x7fff;
+		_changed_max_y = -1;
+	}
+};
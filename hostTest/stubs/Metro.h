@@ -0,0 +1,20 @@
+// Metro.h - host test stub, same behaviour as Metro library with autoreset
+#pragma once
+#include <Arduino.h>
+
+struct Metro {
+	unsigned long previous_millis = 0, interval_millis;
+	Metro(unsigned long interval) : interval_millis(interval) {}
+	void interval(unsigned long i) { interval_millis = i; }
+	bool check()
+	{
+		unsigned long now = millis();
+		if (interval_millis == 0 || now - previous_millis >= interval_millis)
+		{
+			previous_millis = now;
+			return true;
+		}
+		return false;
+	}
+	void reset() { previous_millis = millis(); }
+};
@@ -0,0 +1,2 @@
+// SPI.h - host test stub
+#pragma once
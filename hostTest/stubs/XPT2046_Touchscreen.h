@@ -0,0 +1,15 @@
+// XPT2046_Touchscreen.h - host test stub, touch set by hostTouch
+#pragma once
+#include <Arduino.h>
+
+struct TS_Point { int16_t x, y, z; };
+extern TS_Point hostTouch;								// z = 0, not touched
+
+struct XPT2046_Touchscreen {
+	XPT2046_Touchscreen(int, int) {}
+	bool begin() { return true; }
+	void setRotation(int) {}
+	bool tirqTouched() { return hostTouch.z != 0; }
+	bool touched() { return hostTouch.z != 0; }
+	TS_Point getPoint() { return hostTouch; }
+};
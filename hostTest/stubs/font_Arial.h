@@ -0,0 +1,2 @@
+#pragma once
+extern const ILI9341_t3_font_t Arial_8;
@@ -0,0 +1,3 @@
+#pragma once
+extern const ILI9341_t3_font_t AwesomeF000_10;
+extern const ILI9341_t3_font_t AwesomeF000_16;
@@ -0,0 +1,17 @@
+#pragma once
+extern const ILI9341_t3_font_t LiberationSansNarrow_8_Bold;
+extern const ILI9341_t3_font_t LiberationSansNarrow_9_Bold;
+extern const ILI9341_t3_font_t LiberationSansNarrow_10_Bold;
+extern const ILI9341_t3_font_t LiberationSansNarrow_12_Bold;
+extern const ILI9341_t3_font_t LiberationSansNarrow_14_Bold;
+extern const ILI9341_t3_font_t LiberationSansNarrow_16_Bold;
+extern const ILI9341_t3_font_t LiberationSansNarrow_18_Bold;
+extern const ILI9341_t3_font_t LiberationSansNarrow_20_Bold;
+extern const ILI9341_t3_font_t LiberationSansNarrow_24_Bold;
+extern const ILI9341_t3_font_t LiberationSansNarrow_28_Bold;
+extern const ILI9341_t3_font_t LiberationSansNarrow_32_Bold;
+extern const ILI9341_t3_font_t LiberationSansNarrow_40_Bold;
+extern const ILI9341_t3_font_t LiberationSansNarrow_48_Bold;
+extern const ILI9341_t3_font_t LiberationSansNarrow_60_Bold;
+extern const ILI9341_t3_font_t LiberationSansNarrow_72_Bold;
+extern const ILI9341_t3_font_t LiberationSansNarrow_96_Bold;
@@ -0,0 +1,157 @@
+// hostSim.cpp - host test stub globals
+// included once by each test, after the sketch
+
+#include <chrono>
+
+uint64_t simMicros = 0;
+void (*hostDelay)(unsigned long ms) = nullptr;
+HardwareSerial Serial, Serial1, Serial3;
+EEPROMClass EEPROM;
+int hostAdcFwd = 0, hostAdcRef = 0;
+void (*hostAnalogRead)() = nullptr;
+TS_Point hostTouch = { 0, 0, 0 };
+uint16_t hostPanel[HOST_TFT_W * HOST_TFT_H];
+int hostDmaCount = 0;
+
+#define HOST_FONT(n)	const ILI9341_t3_font_t LiberationSansNarrow_##n##_Bold = { n * 7 / 10, n + n / 4 };
+HOST_FONT(8) HOST_FONT(9) HOST_FONT(10) HOST_FONT(12) HOST_FONT(14) HOST_FONT(16) HOST_FONT(18) HOST_FONT(20)
+HOST_FONT(24) HOST_FONT(28) HOST_FONT(32) HOST_FONT(40) HOST_FONT(48) HOST_FONT(60) HOST_FONT(72) HOST_FONT(96)
+const ILI9341_t3_font_t Arial_8 = { 6, 10 };
+const ILI9341_t3_font_t AwesomeF180_14 = { 10, 17 };
+const ILI9341_t3_font_t AwesomeF000_10 = { 7, 12 };
+const ILI9341_t3_font_t AwesomeF000_16 = { 11, 20 };
+
+// detector signal as low noise profile codes, converted to raw ADC codes of current profile
+// -1 - hostAdcFwd, hostAdcRef used as set
+int hostFwd = -1, hostRef = -1;
+
+int hostRaw(int code, int offs)
+{
+	int raw = ((int64_t)(code - offs) << 16) / adcProf[currProf].gainQ16;
+	return constrain(raw, 0, (int)adcMaxCode);
+}
+
+// IntervalTimer - run getADC() at the current sample rate for ms of simulated time
+void hostSampling(unsigned long ms)
+{
+	uint64_t end = simMicros + (uint64_t)ms * 1000;
+	while (simMicros < end)
+	{
+		if (hostFwd >= 0)
+			hostAdcFwd = hostRaw(hostFwd, adcProf[currProf].fwdOffs);
+		if (hostRef >= 0)
+			hostAdcRef = hostRaw(hostRef, adcProf[currProf].refOffs);
+		getADC();
+		simMicros += 1000000 / sampleFreq;
+	}
+}
+
+// loop() for ms of simulated time, sampling between passes
+// returns number of loop() passes
+int hostRun(int ms)
+{
+	int passes = 0;
+	for (uint64_t end = simMicros + ms * 1000ULL; simMicros < end; passes++)
+	{
+		hostSampling(1);
+		loop();
+	}
+	return passes;
+}
+
+// host time between clock points (nanosecs), for cost benchmarks
+typedef std::chrono::steady_clock hostClk;
+
+double hostNs(hostClk::time_point a, hostClk::time_point b)
+{
+	return std::chrono::duration<double, std::nano>(b - a).count();
+}
+
+// FNV-1a hash of panel image
+uint32_t hostPanelHash()
+{
+	uint32_t h = 2166136261u;
+	for (unsigned i = 0; i < sizeof(hostPanel) / 2; i++)
+	{
+		h = (h ^ (hostPanel[i] & 0xFF)) * 16777619u;
+		h = (h ^ (hostPanel[i] >> 8)) * 16777619u;
+	}
+	return h;
+}
+
+/*------  simulated IC-7300 on the C-IV bus ---------------*/
+// replies to frequency, power, tuner and spectrum ref reads, records writes
+// hostRadioOn() connects it to Serial1
+struct HostRadio {
+	long freqHz = 14074000;
+	int pwr = 128;											// RF power 0-255
+	bool isBadReply = false;								// next power read reply has wrong address
+	int busyWrites = 0;										// next civWrite()s not echoed, bus busy - time out
+	int pwrReads = 0, freqWrites = 0;
+	uint64_t pwrWriteMicros = 0;							// time of last power write on the wire
+} hostRadio;
+
+uint8_t hostBCD(int n) { return n / 10 * 16 + n % 10; }
+int hostDec(uint8_t b) { return b / 16 * 10 + b % 16; }
+
+void hostRadioFrame(HardwareSerial& s, const std::vector<uint8_t>& f)
+{
+	std::vector<uint8_t> cmd(f.begin() + 4, f.end() - 1);	// after preamble, before 0xFD
+	std::vector<uint8_t> data;
+	if (f.size() < 5 || f[2] != CIVRADIO)
+		return;
+
+	if (cmd.size() == 1 && cmd[0] == 0x03)					// read frequency
+	{
+		long hz = hostRadio.freqHz;
+		data = { 0x03, hostBCD(hz % 100), hostBCD(hz / 100 % 100), hostBCD(hz / 10000 % 100), hostBCD(hz / 1000000 % 100), 0x00 };
+	}
+	else if (cmd.size() == 6 && cmd[0] == 0x00)				// write frequency
+	{
+		hostRadio.freqHz = hostDec(cmd[1]) + hostDec(cmd[2]) * 100L + hostDec(cmd[3]) * 10000L + hostDec(cmd[4]) * 1000000L;
+		hostRadio.freqWrites++;
+	}
+	else if (cmd.size() == 2 && cmd[0] == 0x14 && cmd[1] == 0x0A)	// read RF power
+	{
+		data = { 0x14, 0x0A, hostBCD(hostRadio.pwr / 100), hostBCD(hostRadio.pwr % 100) };
+		hostRadio.pwrReads++;
+	}
+	else if (cmd.size() == 4 && cmd[0] == 0x14 && cmd[1] == 0x0A)	// write RF power
+	{
+		hostRadio.pwr = hostDec(cmd[2]) * 100 + hostDec(cmd[3]);
+		hostRadio.pwrWriteMicros = simMicros;
+	}
+	else if (cmd == std::vector<uint8_t>{ 0x1C, 0x01 } || cmd == std::vector<uint8_t>{ 0x27, 0x19, 0x00 })
+	{
+		data = cmd;												// tuner status, spectrum ref - zero
+		data.insert(data.end(), { 0x00, 0x00, 0x00 });
+	}
+	if (data.empty())
+		return;
+
+	uint8_t addr = CIVRADIO;
+	if (data[0] == 0x14 && hostRadio.isBadReply)
+	{
+		addr = 0x00;
+		hostRadio.isBadReply = false;
+	}
+	for (uint8_t c : { (uint8_t)0xFE, (uint8_t)0xFE, (uint8_t)CIVADDR, addr })
+		s.rx.push_back(c);
+	for (uint8_t c : data)
+		s.rx.push_back(c);
+	s.rx.push_back(0xFD);
+}
+
+void hostRadioOn()
+{
+	Serial1.isEcho = true;
+	Serial1.onFrame = hostRadioFrame;
+	Serial1.onFlush = [](HardwareSerial& s) {
+		s.isEcho = hostRadio.busyWrites == 0;
+		if (hostRadio.busyWrites > 0)
+			hostRadio.busyWrites--;
+	};
+}
+
+int hostFails = 0;
+#define HOST_CHECK(cond, ...)	do { if (!(cond)) { hostFails++; printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); } } while (0)
@@ -0,0 +1,111 @@
+/*-----------------------------------------------------------------------------------
+SWR / POWER METER + IC7300 C-IV CONTROLLER
+
+Swr/PowerMeter (basic) - https://github.com/GI8GZM/PowerSwrMeter
+Swr/PowerMeter + IC7300 C-IV Controller - https://github.com/GI8GZM/PowerMeter-CIVController
+
+ Copyright 2018-2020  Roger Mawhinney, GI8GZM.
+No publication without acknowledgement to author
+-------------------------------------------------------------------------------------*/
+
+
+// idle.ino
+// idle mode - no power for IDLE_DELAY, drop ADC sample rate, pause measure() and slow CI-V polling
+// getADC() wakes on first forward sample above PWR_THRESHOLD, see adc.ino
+
+/*---------------------------------------------------------
+idle / active time counters (mSecs) and wake latency (microsecs)
+wake latency is time from first sample above threshold to first
+net power display at or above threshold
+*/
+unsigned long idleMillis = 0, activeMillis = 0;				// total time idle / active
+unsigned long stateMillis = 0;								// time of last idle / active change
+unsigned long lastPwrMillis = 0;							// time power last on, or touch
+unsigned long wakeLatency = 0, maxWakeLatency = 0;			// last and max wake latency
+unsigned int wakeCount = 0, wakeLateCount = 0;				// wakes, wakes over WAKE_TARGET
+bool wasIdle = false;										// idle at last idleMain()
+
+
+
+/*--------------------------------- idleMain() --------------------------------------
+checks for wake by getADC() and idle timeout
+called by loop(), returns true if idle
+*/
+bool idleMain()
+{
+	unsigned long ms = millis();
+
+	// woken by getADC() - power on
+	if (wasIdle && !isIdle)
+	{
+		idleMillis += ms - stateMillis;
+		stateMillis = ms;
+		lastPwrMillis = ms;
+		wasIdle = false;
+	}
+
+	// no power for IDLE_DELAY. radio volts needs continuous measure()
+	if (!wasIdle && !fr[vInVolts].isEnable && ms - lastPwrMillis > IDLE_DELAY)
+	{
+		activeMillis += ms - stateMillis;
+		stateMillis = ms;
+		wasIdle = true;
+		setIdle(true);
+	}
+
+	return isIdle;
+}
+
+/*--------------------------------- idleReset() --------------------------------------
+restarts idle timeout, wakes if idle
+called by measure() while power on and by loop() on touch
+*/
+void idleReset()
+{
+	lastPwrMillis = millis();
+	if (isIdle)
+		setIdle(false);
+}
+
+/*--------------------------------- wakeDisplayed() --------------------------------------
+records wake latency, called by measure() after net power display at or above threshold
+*/
+void wakeDisplayed()
+{
+	unsigned long t;
+
+	// wakeMicros is set by getADC(), zero if already recorded
+	noInterrupts();
+	t = wakeMicros;
+	wakeMicros = 0;
+	interrupts();
+	if (t == 0)
+		return;
+
+	wakeLatency = micros() - t;
+	if (wakeLatency > maxWakeLatency)
+		maxWakeLatency = wakeLatency;
+	if (wakeLatency > WAKE_TARGET)
+		wakeLateCount++;
+	wakeCount++;
+}
+
+/*--------------------------------- printIdleStats() --------------------------------------
+prints idle / active time and wake latency to USB serial
+called by measure() at end of transmission
+*/
+void printIdleStats()
+{
+	if (!Serial)
+		return;
+
+	// include current state time
+	unsigned long idle = idleMillis, active = activeMillis;
+	if (wasIdle)
+		idle += millis() - stateMillis;
+	else
+		active += millis() - stateMillis;
+
+	Serial.printf("Idle %lus  Active %lus  Wake %luus  Max %luus  Over %dus: %u of %u\n",
+		idle / 1000, active / 1000, wakeLatency, maxWakeLatency, WAKE_TARGET, wakeLateCount, wakeCount);
+}
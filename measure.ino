@@ -20,7 +20,8 @@ void measure()
 	float  fwdV = 0, refV = 0, fwdPkV, refPkV;							// calulated ADC voltages
 	float fwdPwr = 0.0, refPwr = 0.0, fwdPkPwr, refPkPwr;				// calculated powers
 	float netPwr, pep, dB;
-	static float pkPwr = 0, swr = 1.0;
+	static float pkPwr = 0, swr = 1.0, rl = RL_MAX;
+	bool isTx = false;													// power on during this measure()
 
 	float vIn;
 	float adcConvert = 3.3 / adc->adc0->getMaxValue();					// 3.3 (max volts) / adc max value, varies with resolution+
@@ -35,6 +36,9 @@ void measure()
 	{
 		digitalWrite(TEST_PIN, !digitalRead(TEST_PIN));					// toggle test pin to HALF frequency
 
+		// swr protection - cut power on trip
+		protectMain();
+
 		// measure radio input volts, 4k7 / 1k  divider
 		int va = (uint16_t)adc->analogRead(VIN_ADC_PIN);
 		vIn = (float)va * adcConvert * 5.7;
@@ -96,9 +100,13 @@ void measure()
 
 		// dBm - select by netPower longtouch
 		// =  10* log10 (1000 * watts) cannot be less than 0
+#ifdef FAST_MATH
+		dB = fastDbm(netPwr);
+#else
 		dB = 10 * log10(netPwr * 1000);
 		if (dB < 0)
 			dB = 0.0;
+#endif
 
 
 		// swr calculation - only calculate if power on. do not use netPwr as signal processed
@@ -106,29 +114,39 @@ void measure()
 		// peak power preferred - stops SWR changes on power off as netpower decreases
 		if (fwdPkPwr > PWR_THRESHOLD && fwdPkPwr > refPkPwr)
 		{
+#ifdef FAST_MATH
+			// return loss and swr from lookup tables
+			rl = fastRetLoss(fwdPkPwr, refPkPwr);
+			swr = fastSwr(rl);
+#else
 			// reflection coefficient
 			float rc = sqrt(refPkPwr / fwdPkPwr);
 			if (rc == NAN || isnan(rc))
+			{
 				swr = 1.0;
+				rl = RL_MAX;
+			}
 			else
 			{
 				swr = (1 + rc) / (1 - rc);
 				if (swr <= 1.0)
 					swr = 1.0;
-				if (swr > 999.9)
-					swr = 999.9;
+				if (swr > SWR_MAX)
+					swr = SWR_MAX;
+
+				// return loss (dB) = -20 * log10(rc)
+				rl = RL_MAX;
+				if (rc > 0)
+					rl = -20 * log10(rc);
+				if (rl > RL_MAX)
+					rl = RL_MAX;
 			}
+#endif
 
-			// swr display colour based on value
-			int swrColour = GREEN;
-			if (swr > 1.5)
-			{
-				// change through yellow to orange to red for swr > 1.5
-				int grn = map(swr, 1.5, 3.0, 255, 0);
-				grn = constrain(grn, 0, 255);
-				swrColour = CL(255, grn, 0);
-			}
-			val[vswr].colour = swrColour;
+			// swr display colour based on value, white on red when tripped
+			val[vswr].colour = isTrip ? FG_COLOUR : swrColour(swr);
+			val[retLoss].colour = val[vswr].colour;
+			val[stripSwr].colour = val[vswr].colour;
 		}
 
 		// display net power, if power on, use RED background
@@ -148,17 +166,23 @@ void measure()
 
 		netPwr = sigProcess(netPower, netPwr, weight);
 		displayValue(netPower, netPwr);
+		if (netPwr >= PWR_THRESHOLD)
+			wakeDisplayed();											// wake latency, if woken from idle
 		analogWrite(A14, (int)netPwr * 255 / 100);
 
 		displayValue(dBm, dB);
 		displayValue(peakPower, pkPwr);
 		displayValue(vswr, swr);
+		displayValue(retLoss, rl);
+		displayValue(stripPwr, netPwr);
+		displayValue(stripSwr, swr);
 		displayValue(fwdPower, fwdPwr);
 		displayValue(refPower, refPwr);
 		displayValue(fwdVolts, fwdV);
 		displayValue(refVolts, refV);
 		drawMeter(netPwrMeter, netPwr, pkPwr);
 		drawMeter(swrMeter, swr, 1);
+		envStatsMain();
 		//plot((int(pep)));
 
 #ifdef CIV
@@ -169,14 +193,21 @@ void measure()
 			displayValue(freq, getFreq());
 #endif
 
-		// check for dimmed screen and reset
+		// check for dimmed screen and reset, restart idle timeout
 		if (netPwr >= PWR_THRESHOLD)
+		{
 			resetDimmer();
+			idleReset();
+			isTx = true;
+		}
 
-		// check if screen has been touched
-		if (ts.tirqTouched())
+		// check if screen has been touched, options screen or main screen
+		if (ts.tirqTouched() && !optTouch())
 			chkTouchFrame(sizeof(fr) / sizeof(frame));
 
+		// frame buffer to tft
+		updateDisplay(false);
+
 		// ensure measure loop slower than getADC() sample frequency
 		// measure loop = 30microsecs, delay(>5) millisecs
 		//delay(5);
@@ -191,6 +222,13 @@ void measure()
 		restoreFrame(netPower);
 		displayValue(netPower, 0, true);
 	}
+
+	// end of transmission - statistics to serial, whichever frames are shown
+	if (isTx)
+	{
+		printEnvStats();
+		printIdleStats();
+	}
 }
 
 
@@ -226,6 +264,47 @@ float pwrCalc(float v)
 }
 
 
+/*----------------------------------- pwrToCode() ----------------------------------------------------------------
+lowest forward ADC code with power >= watts
+binary search, pwrCalc() increases with volts
+*/
+unsigned int pwrToCode(float watts)
+{
+	float adcConvert = 3.3 / adc->adc0->getMaxValue();
+	unsigned int lo = 0, hi = adc->adc0->getMaxValue();
+
+	while (lo < hi)
+	{
+		unsigned int mid = (lo + hi) / 2;
+		if (pwrCalc(mid * adcConvert + FV_ZEROADJ) < watts)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo;
+}
+
+
+/*----------------------------------- swrColour() ----------------------------------------------------------------
+swr display colour
+green to swr 1.5, then through yellow to orange to red at swr 3.0
+integer maths, swr in tenths
+*/
+int swrColour(float swr)
+{
+	int swr10 = (int)(swr * 10);
+
+	if (swr10 <= 15)
+		return GREEN;
+	if (swr10 >= 30)
+		return CL(255, 0, 0);
+
+	// green 255 to 0 over swr 1.5 to 3.0 (15 tenths)
+	int grn = (30 - swr10) * 17;
+	return CL(255, grn, 0);
+}
+
+
 /*----------------- sigProcess --------------------------------------
 signal processing - fast attack, exponential decay
 weight controls decay
@@ -9,27 +9,147 @@ No publication without acknowledgement to author
 -------------------------------------------------------------------------------------*/
 
 
-/*----------------------------setAvgSamples()--------------------------------------------
-set samples options
+/*---------------------------------------------------------
+options screens are not modal - measure(), C-IV tuner, autoband continue
+touches are passed to optTouch() by loop() and measure() while a screen is open
+main screen frames stay enabled but hidden (isHide), so displayValue() etc. do not draw
+options layouts draw over every main screen frame and between them, so exit redraws the main screen
+*/
+int avgSamplesStat = 0;										// samples setting on open, see drawAvgOpts()
+
+
+
+/*----------------------------optViewOpen()--------------------------------------------
+opens options screen, called by buttons and options Exit / More..
+hides main screen frames, options frames from a previous screen are disabled
+*/
+void optViewOpen(int view)
+{
+	int numFrames = sizeof(fr) / sizeof(frame);
+
+	// main screen frames keep running hidden, options show their own
+	for (int i = 0; i < numFrames; i++)
+	{
+		if (optView != noView && !fr[i].isHide)
+			fr[i].isEnable = false;
+		fr[i].isHide = true;
+	}
+
+	optView = view;
+	tft.fillScreen(BG_COLOUR);
+	tft.setTextColor(WHITE);
+
+	switch (view)
+	{
+	case avgView:
+		optTouchNum = drawAvgOpts();
+		break;
+#ifdef CIV
+	case tuneABandView:
+		optTouchNum = drawTunerABandOpts();
+		break;
+	case tuneTimeView:
+		optTouchNum = drawTunerAbandTimeOpts();
+		break;
+#endif
+	default:
+		break;
+	}
+
+	// live power and swr, updated by measure()
+	fr[stripPwr].isHide = false;
+	fr[stripSwr].isHide = false;
+	restoreFrame(stripPwr);
+	restoreFrame(stripSwr);
+}
+
+/*----------------------------optTouch()--------------------------------------------
+called by loop() and measure() when screen touched
+returns false if no options screen, touch is for main screen
+*/
+bool optTouch()
+{
+	int n;
+
+	if (optView == noView)
+		return false;
+
+	// averaging allows repeat for +/- buttons
+	n = chkTouchOption(optTouchNum, optView == avgView);
+	switch (optView)
+	{
+	case avgView:
+		avgOptsTouch(n);
+		break;
+#ifdef CIV
+	case tuneABandView:
+		tunerABandOptsTouch(n);
+		break;
+	case tuneTimeView:
+		tunerAbandTimeOptsTouch(n);
+		break;
+#endif
+	default:
+		break;
+	}
+	return true;
+}
+
+/*----------------------------optViewClose()--------------------------------------------
+closes options screen
+disables options frames, unhides and redraws main screen frames
+whole screen - every main frame is under the options layout, see hostTest/optViewTest.cpp
+*/
+void optViewClose()
+{
+	int numFrames = sizeof(fr) / sizeof(frame);
+
+	for (int i = 0; i < numFrames; i++)
+	{
+		if (!fr[i].isHide)
+			fr[i].isEnable = false;
+		fr[i].isHide = false;
+	}
+	optView = noView;
+	drawDisplay();
+
+	// meter bars are redrawn from scale start
+	for (int i = netPwrMeter; i <= swrMeter; i++)
+	{
+		val[i].prevDispVal = mtr[i - netPwrMeter].sStart;
+		mtr[i - netPwrMeter].pkPrevPosn = fr[i].x;
+	}
+
+#ifdef CIV
+	// freq difference only displayed on status change
+	if (isCivEnable)
+		freqTuneStatus(currFreq, -1);
+#endif
+
+	// wait for Exit release, not a main screen touch
+	while (ts.touched());
+}
+
+
+
+/*----------------------------drawAvgOpts()--------------------------------------------
+averaging options screen
 measure - samples register size, default & alternate
 calibrate - samples register size
+returns last touch index, Exit
 */
-void setAvgSamples()
+int drawAvgOpts()
 {
 	int x, y;
-	int n;
-	int samplesStat;									// samplesAvg status
 
 	// save current samplesAvg setting, restore on exit
+	avgSamplesStat = 0;
 	if (samples == optCal.val)				
-		samplesStat = 1;								
+		avgSamplesStat = 1;								
 	if (samples == optDefault.val)
-		samplesStat = 2;
+		avgSamplesStat = 2;
 	if (samples == optAlt.val)
-		samplesStat = 3;
-
-	tft.fillScreen(BG_COLOUR);
-	tft.setTextColor(WHITE);
+		avgSamplesStat = 3;
 
 	// screen header, centred
 	tft.setFont(FONT12);
@@ -47,84 +167,97 @@ void setAvgSamples()
 	x = 135; y = 210;
 	drawTextBoxOpts(x, y, "Exit", tIndex);
 
+	avgOptsValues();
+	return tIndex;
+}
 
-	// touch screen options
-	do
+/*----------------------------avgOptsValues()--------------------------------------------
+display averaging option values
+*/
+void avgOptsValues()
+{
+	displayValue(samplesCalOpt, optCal.val);
+	displayValue(samplesDefOpt, optDefault.val);
+	displayValue(samplesAltOpt, optAlt.val);
+	displayValue(weighting, (float)optWeight.val / 1000);
+}
+
+/*----------------------------avgOptsTouch()--------------------------------------------
+averaging options screen touch, n = touch index
+*/
+void avgOptsTouch(int n)
+{
+	switch (n)
+	{
+	case 0:										// increment sample size, limit to max
+		if (optCal.val == 1)
+			optCal.val += SAMPLES_CHANGE - 1;
+		else
+			optCal.val += SAMPLES_CHANGE;
+		if (optCal.val >= 100)
+			optCal.val = 100;
+		break;
+	case 1:										// decrement sample size, min = 1
+		optCal.val -= SAMPLES_CHANGE;
+		if (optCal.val <= 1)
+			optCal.val = 0;
+		break;
+	case 2:										// increment sample size, limit to max
+		if (optDefault.val == 1)
+			optDefault.val += SAMPLES_CHANGE - 1;
+		else optDefault.val += SAMPLES_CHANGE;
+		if (optDefault.val >= 100)
+			optDefault.val = 100;
+		break;
+	case 3:										// decrement sample size, min = 1
+		optDefault.val -= SAMPLES_CHANGE;
+		if (optDefault.val <= 1)
+			optDefault.val = 0;
+		break;
+	case 4:										// increment calibrate sample size
+		if (optAlt.val == 1)
+			optAlt.val += SAMPLES_CHANGE - 1;
+		else optAlt.val += SAMPLES_CHANGE;
+		if (optAlt.val >= 100)
+			optAlt.val = 100;
+		break;
+	case 5:										// decrement calibrate sample size, min = 1
+		optAlt.val -= SAMPLES_CHANGE;
+		if (optAlt.val <= 1)
+			optAlt.val = 0;
+		break;
+	case 6:
+		// exponential weighting * 1000, ie 50 = 50/1000 = .05
+		if (optWeight.val > 50)
+			optWeight.val += 20;
+		else
+			optWeight.val += 1;
+		// max: 1000/1000 = 1.0
+		if (optWeight.val >= 1000)
+			optWeight.val = 1000;
+		break;
+	case 7:
+		// decrement calibrate sample size, min = 1
+		if (optWeight.val > 50)				// 0.1
+			optWeight.val -= 20;
+		else
+			optWeight.val -= 1;
+		// min: 1/1000 = .001
+		if (optWeight.val <= 1)				
+			optWeight.val = 1;
+		break;
+	default:
+		break;
+	}
+
+	// not Exit - display new values
+	if (n < optTouchNum)
 	{
-		// display parameters
-		displayValue(samplesCalOpt, optCal.val);
-		displayValue(samplesDefOpt, optDefault.val);
-		displayValue(samplesAltOpt, optAlt.val);
-		displayValue(weighting, (float)optWeight.val / 1000);
-
-		n = chkTouchOption(tIndex, true);						// check which box touched, allow repeat
-		switch (n)
-		{
-		case 0:										// increment sample size, limit to max
-			if (optCal.val == 1)
-				optCal.val += SAMPLES_CHANGE - 1;
-			else
-				optCal.val += SAMPLES_CHANGE;
-			if (optCal.val >= 100)
-				optCal.val = 100;
-			break;
-		case 1:										// decrement sample size, min = 1
-			optCal.val -= SAMPLES_CHANGE;
-			if (optCal.val <= 1)
-				optCal.val = 0;
-			break;
-		case 2:										// increment sample size, limit to max
-			if (optDefault.val == 1)
-				optDefault.val += SAMPLES_CHANGE - 1;
-			else optDefault.val += SAMPLES_CHANGE;
-			if (optDefault.val >= 100)
-				optDefault.val = 100;
-			break;
-		case 3:										// decrement sample size, min = 1
-			optDefault.val -= SAMPLES_CHANGE;
-			if (optDefault.val <= 1)
-				optDefault.val = 0;
-			break;
-		case 4:										// increment calibrate sample size
-			if (optAlt.val == 1)
-				optAlt.val += SAMPLES_CHANGE - 1;
-			else optAlt.val += SAMPLES_CHANGE;
-			if (optAlt.val >= 100)
-				optAlt.val = 100;
-			break;
-		case 5:										// decrement calibrate sample size, min = 1
-			optAlt.val -= SAMPLES_CHANGE;
-			if (optAlt.val <= 1)
-				optAlt.val = 0;
-			break;
-		case 6:
-			// exponential weighting * 1000, ie 50 = 50/1000 = .05
-			if (optWeight.val > 50)
-				optWeight.val += 20;
-			else
-				optWeight.val += 1;
-			// max: 1000/1000 = 1.0
-			if (optWeight.val >= 1000)
-				optWeight.val = 1000;
-			break;
-		case 7:
-			// decrement calibrate sample size, min = 1
-			if (optWeight.val > 50)				// 0.1
-				optWeight.val -= 20;
-			else
-				optWeight.val -= 1;
-			// min: 1/1000 = .001
-			if (optWeight.val <= 1)				
-				optWeight.val = 1;
-			break;
-		default:
-			break;
-		}
-		// do while touched item is less than total items
-	} while (n < tIndex);								
-
-
-	switch (samplesStat)							// reset samplesAvg using new values
+		avgOptsValues();
+		return;
+	}
+
+	switch (avgSamplesStat)							// reset samplesAvg using new values
 	{
 	case 1:
 		samples = optCal.val;
@@ -142,8 +275,9 @@ void setAvgSamples()
 	EEPROM.put(optAlt.eeAddr, optAlt);
 	EEPROM.put(optWeight.eeAddr, optWeight);
 
-	// clean up
-	initDisplay();
+	// clean up, update averaging button
+	optViewClose();
+	avgOptionsLabel();
 }
 
 /*-------------------------drawPlusMinusOpts()--------------------------------------
@@ -162,6 +296,7 @@ int drawPlusMinusOpts(int posn, const char* txt, int tIndex)
 	y = fr[posn].y + fnt.cap_height;
 	tft.setCursor(x, y);
 	tft.printf(txt);
+	fPtr->isHide = false;
 	restoreFrame(posn);
 
 	// font for Plus - minus symbols
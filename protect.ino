@@ -0,0 +1,162 @@
+/*-----------------------------------------------------------------------------------
+SWR / POWER METER + IC7300 C-IV CONTROLLER
+
+Swr/PowerMeter (basic) - https://github.com/GI8GZM/PowerSwrMeter
+Swr/PowerMeter + IC7300 C-IV Controller - https://github.com/GI8GZM/PowerMeter-CIVController
+
+ Copyright 2018-2020  Roger Mawhinney, GI8GZM.
+No publication without acknowledgement to author
+-------------------------------------------------------------------------------------*/
+
+
+// protect.ino
+// high swr / reflected power protection
+// protectCheck() is called by getADC() for every sample block, latches trip
+// protectMain() cuts radio RF power via C-IV and displays fault, touch swr to restore
+
+/*---------------------------------------------------------
+trip limits are converted to ADC codes by initProtect(), no float maths in interrupt
+tripRefCode - reflected code for TRIP_SWR, for each forward histogram bin (see statsBin())
+			  bin lowest code (statsBinLow()) is used, trips early by less than one bin
+*/
+volatile int tripBlocks = 0;								// consecutive blocks over limit
+bool isTripCut = false;										// RF power cut, fault displayed
+int tripPrevPwr = 0;										// radio power before trip, 0-255
+unsigned long tripLatency = 0, maxTripLatency = 0;			// trip to power cut (microsecs)
+unsigned int tripFwdCode;									// fwd code for PWR_THRESHOLD
+unsigned int tripRefPwrCode;								// ref code for TRIP_REF_PWR
+uint16_t tripRefCode[STATS_BINS];
+
+
+
+/*--------------------------------- protectCheck() --------------------------------------
+called by getADC() interrupt with block average forward and reflected codes
+*/
+void protectCheck(unsigned int fwd, unsigned int ref)
+{
+	if (isTrip)
+		return;
+
+	if (ref >= tripRefPwrCode || (fwd >= tripFwdCode && ref >= tripRefCode[statsBin(fwd)]))
+	{
+		tripBlocks++;
+		if (tripBlocks >= TRIP_BLOCKS)
+		{
+			isTrip = true;
+			tripMicros = micros();
+		}
+	}
+	else
+		tripBlocks = 0;
+}
+
+/*--------------------------------- protectMain() --------------------------------------
+on trip - cut RF power, display fault
+called by measure() every loop and loop()
+*/
+void protectMain()
+{
+	if (!isTrip || isTripCut)
+		return;
+
+#ifdef CIV
+	// priority - power to zero first, last good radio power from getTxPwr() / putTxPwr()
+	// C-IV write failed (timeout, collision) - not cut, try again next pass
+	if (isCivEnable)
+	{
+		tripPrevPwr = txPwrLevel;
+		if (!putTxPwr(0))
+			return;
+	}
+#endif
+	tripLatency = micros() - tripMicros;
+	if (tripLatency > maxTripLatency)
+		maxTripLatency = tripLatency;
+	isTripCut = true;
+
+	// fault on swr or return loss frame, whichever displayed
+	tripDisplay(vswr, true);
+	tripDisplay(retLoss, true);
+
+	if (Serial)
+		Serial.printf("SWR trip  %.1f  Ref %.1fW  Cut %luus  Max %luus\n",
+			TRIP_SWR, TRIP_REF_PWR, tripLatency, maxTripLatency);
+}
+
+/*--------------------------------- protectAck() --------------------------------------
+touch swr or return loss when tripped - restore radio power, clear fault
+*/
+void protectAck()
+{
+#ifdef CIV
+	if (isCivEnable)
+		putTxPwr(tripPrevPwr);
+#endif
+
+	tripDisplay(vswr, false);
+	tripDisplay(retLoss, false);
+
+	isTripCut = false;
+	noInterrupts();
+	tripBlocks = 0;
+	isTrip = false;
+	interrupts();
+}
+
+/*--------------------------------- tripDisplay() --------------------------------------
+sets frame background and value colour for fault, redraws frame if enabled
+*/
+void tripDisplay(int posn, bool isFault)
+{
+	fr[posn].bgColour = isFault ? RED : BG_COLOUR;
+	if (isFault)
+		val[posn].colour = FG_COLOUR;
+	if (!fr[posn].isEnable)
+		return;
+
+	char txt[] = "TRIP";
+
+	restoreFrame(posn);
+	if (isFault)
+		displayLabel(posn, txt);
+}
+
+
+
+/*------------------------------------ initProtect() ----------------------------------
+converts trip limits to ADC codes
+called by setup() after initADC()
+*/
+void initProtect()
+{
+	float adcConvert = 3.3 / adc->adc0->getMaxValue();
+
+	// reflection coefficient squared = ref / fwd power at TRIP_SWR
+	float rc = (TRIP_SWR - 1) / (TRIP_SWR + 1);
+
+	for (int i = 0; i < STATS_BINS; i++)
+	{
+		// lowest code in bin
+		float fwdPwr = pwrCalc(statsBinLow(i) * adcConvert + FV_ZEROADJ);
+		tripRefCode[i] = refPwrToCode(fwdPwr * rc * rc);
+	}
+
+	tripFwdCode = pwrToCode(PWR_THRESHOLD);
+	tripRefPwrCode = refPwrToCode(TRIP_REF_PWR);
+}
+
+/*------------------------------------ refPwrToCode() ----------------------------------
+lowest reflected ADC code with power >= watts
+pwrToCode() adjusted for reflected zero offset
+*/
+unsigned int refPwrToCode(float watts)
+{
+	float adcConvert = 3.3 / adc->adc0->getMaxValue();
+	long code = pwrToCode(watts) + lround((FV_ZEROADJ - RV_ZEROADJ) / adcConvert);
+
+	if (code < 0)
+		code = 0;
+	if (code > (long)adc->adc0->getMaxValue())
+		code = adc->adc0->getMaxValue();
+	return code;
+}
@@ -16,29 +16,88 @@ No publication without acknowledgement to author
 #define	btSerial        Serial3					    // bluetooth serial3 - pins 7,8
 #endif
 
+/*------  board profile - TEENSY40 set in PowerMeter-CIVController.ino -----*/
+#if defined(TEENSY40) && !defined(__IMXRT1062__)
+#error TEENSY40 defined, board is not Teensy 4.0
+#endif
+#if !defined(TEENSY40) && defined(__IMXRT1062__)
+#error board is Teensy 4.0, define TEENSY40
+#endif
+
+// low noise and fast ADC profile settings, see adcProf[]
+#ifdef TEENSY40
+#define BOARD_RAM		524288						// RAM1 (bytes), static variables
+#define MAXBUF			10000						// max size of circular buffer (sample pairs)
+#define	AVERAGING		0							// keep = 0 for true 12 bit resolution
+#define	RESOLUTION		12							// Teensy 4.0 max resolution
+#define	CONV_SPEED		VERY_LOW_SPEED
+#define	SAMPLE_SPEED	VERY_LOW_SPEED
+#define	FAST_AVERAGING		0						// fast profile - faster conversion, not less averaging
+#define	FAST_CONV_SPEED		HIGH_SPEED
+#define	FAST_SAMPLE_SPEED	HIGH_SPEED
+#else												// Teensy 3.2
+#define BOARD_RAM		65536						// RAM (bytes)
+#define MAXBUF			1000						// max size of circular buffer (sample pairs)
+#define	AVERAGING		16
+#define	RESOLUTION		16							// Teensy 3.2 max resolution
+#define	CONV_SPEED		HIGH_SPEED
+#define	SAMPLE_SPEED	HIGH_SPEED
+#define	FAST_AVERAGING		4
+#define	FAST_CONV_SPEED		HIGH_SPEED
+#define	FAST_SAMPLE_SPEED	VERY_HIGH_SPEED
+#endif
+
+
 /*------  measure() constants -------------------------------*/
 #define	SAMPLE_FREQ		5000						// effective ADC sampling frequency - hertz
-#define MAXBUF			1000						// max size of circular buffers
 #define PEAK_HOLD		2000						// average Peak Pwr hold time (mSecs)
 #define PEP_HOLD		250							// average pep hold time (mSecs)
 #define PWR_THRESHOLD   0.5    						// power on threshold watts
+#define SWR_MAX			999.9						// max displayed swr
+#define RL_MAX			50.0						// max displayed return loss (dB)
+
+
+/*------  fastMath constants - see fastMath.ino -------------*/
+#define LOG2_TAB_BITS	6							// log2 mantissa table, 2^bits entries
+#define LOG2_TAB_SIZE	(1 << LOG2_TAB_BITS)
+#define RL_TAB_STEP		0.25						// swr table return loss step (dB)
+#define RL_TAB_MIN		3.0							// below this return loss (swr > 5.8), swr is calculated
+#define SWR_TAB_SIZE	((int)(RL_MAX / RL_TAB_STEP))	// swr table entries
+#define LOG10_2			0.30103						// log10(2)
+
+
+/*------  idle mode constants - see idle.ino ----------------*/
+#define IDLE_SAMPLE_FREQ	500						// ADC sampling frequency when idle - hertz
+#define IDLE_DELAY			2000					// time without power before idle (mSecs)
+#define IDLE_CIV_POLL		1000					// CI-V poll interval when idle (mSecs)
+#define WAKE_TARGET			50000					// power on to first display target (microsecs)
+
+
+/*------  swr protection constants - see protect.ino --------*/
+#define TRIP_SWR		3.0							// trip swr
+#define TRIP_REF_PWR	25.0						// trip reflected power (watts)
+#define TRIP_BLOCKS		2							// consecutive sample blocks over limit to trip
+#define TX_PWR_POLL		2000						// radio power level refresh, spectrum ref shown (mSecs)
+
+
+/*------  envelope statistics constants - see envStats.ino --*/
+#define STATS_SECS		10							// statistics window (seconds)
+#define STATS_SUB_BITS	3							// histogram bins per ADC code octave = 2^bits
+#define STATS_FREQ		FAST_SAMPLE_FREQ			// count rate, must be a multiple of all sample frequencies
+#define STATS_BINS		((RESOLUTION - STATS_SUB_BITS + 1) << STATS_SUB_BITS)
+#define CCDF_LEVEL		0.1							// displayed CCDF probability (%)
+#define CCDF_STEPS		13							// serial CCDF table, 0 - 12 dB above average
 
 
 /*--------------------------------------- constants for ADC -------------------------*/
-//#define	AVERAGING		0							// keep = 0 for true 12 bit resolutg
-//#define	RESOLUTION		12							// Teensy 4.0 max resolution
-//#define	CONV_SPEED		VERY_LOW_SPEED
-//#define	SAMPLE_SPEED	VERY_LOW_SPEED
-#define	AVERAGING		16							// keep = 0 for true 12 bit resolutg
-#define	RESOLUTION		16							// Teensy 4.0 max resolution
-#define	CONV_SPEED		HIGH_SPEED
-#define	SAMPLE_SPEED	HIGH_SPEED
+// low noise and fast ADC profile settings are in board profile, above
+#define	FAST_SAMPLE_FREQ	10000					// fast profile sampling frequency - hertz, multiple of SAMPLE_FREQ
+#define	SAMPLE_RAM_SHARE	8						// sample buffer RAM budget, 1/share of BOARD_RAM
 
-//// these setting reduce zero offset
-//#define		AVERAGING 4
-//#define		RESOLUTION 16
-//#define		CONV_SPEED HIGH_SPEED
-//#define		SAMPLE_SPEED VERY_HIGH_SPEED
+// ADC profile switching, hysteresis between up and down power
+#define	PROF_UP_PWR			10.0					// switch to fast profile above (watts)
+#define	PROF_DOWN_PWR		5.0						// switch to low noise profile below (watts)
+#define	PROF_BLOCK_BITS		6						// check profile every 2^bits samples
 
 
 
@@ -46,6 +105,9 @@ No publication without acknowledgement to author
 // offset voltages
 #define	FV_ZEROADJ				-0.0001				    // ADC zero offset voltage
 #define	RV_ZEROADJ				-0.0000			        // ADC zero offset voltage
+#define	FAST_FV_ZEROADJ			-0.0000				    // fast profile ADC zero offset voltage
+#define	FAST_RV_ZEROADJ			-0.0000			        // fast profile ADC zero offset voltage
+#define	FAST_GAIN				1.0						// fast profile ADC gain, relative to low noise profile
 
 // Direct power conversion constants
 // forward power constants - new coupler
@@ -74,6 +136,36 @@ No publication without acknowledgement to author
 //#define HI_ADD_PWR			0.4588				// HI pwr = v*v*HI_MULT2_PWR +v*HI_MULT1_PWR + HI_ADD_PWR
 
 
+/*------  ADC profiles --------------------------------------*/
+// low noise profile near PWR_THRESHOLD, fast profile at high power for more pep samples.
+// getADC() converts samples to low noise profile scale using gain and zero offsets,
+// so averaging buffers and pwrCalc() are not affected by a profile change.
+// fast profile samples are averaged to SAMPLE_FREQ for the buffers, peaks use every sample
+struct adcProfile {
+	int averaging;							// ADC hardware averaging
+	ADC_CONVERSION_SPEED convSpeed;			// conversion speed
+	ADC_SAMPLING_SPEED sampleSpeed;			// sampling speed
+	int sampleFreq;							// effective sampling frequency - hertz
+	float fvZeroAdj;						// forward zero offset voltage
+	float rvZeroAdj;						// reflected zero offset voltage
+	float gain;								// ADC gain, relative to low noise profile
+	int gainQ16;							// gain, 16 bit fixed point. set by initADC()
+	int fwdOffs;							// forward offset (ADC codes). set by initADC()
+	int refOffs;							// reflected offset (ADC codes). set by initADC()
+};
+
+enum adcProfileNames {
+	lowNoiseProf,							// high averaging
+	fastProf,								// low averaging, higher sample frequency
+};
+
+adcProfile adcProf[] = {
+//	averaging		convSpeed								sampleSpeed								sampleFreq			fvZeroAdj		rvZeroAdj		gain
+	{ AVERAGING,		ADC_CONVERSION_SPEED::CONV_SPEED,		ADC_SAMPLING_SPEED::SAMPLE_SPEED,		SAMPLE_FREQ,		FV_ZEROADJ,		RV_ZEROADJ,		1.0,	0, 0, 0 },
+	{ FAST_AVERAGING,	ADC_CONVERSION_SPEED::FAST_CONV_SPEED,	ADC_SAMPLING_SPEED::FAST_SAMPLE_SPEED,	FAST_SAMPLE_FREQ,	FAST_FV_ZEROADJ, FAST_RV_ZEROADJ, FAST_GAIN, 0, 0, 0 },
+};
+
+
 #ifdef CIV
 /*----------Icom CI-V Constants------------------------------*/
 #define CIVADDR         0xE2			        	// this controller address
@@ -89,10 +181,13 @@ Metro netPwrTimer = Metro(50);					// net power hold timer
 Metro netPwrPkTimer = Metro(1000);					// peak power hold timer
 Metro pepTimer = Metro(500);				   		// pep hold timer
 Metro plotTimer = Metro(50);				   		// pep hold timer
+Metro statsTimer = Metro(500);						// envelope statistics display timer
 
 #ifdef CIV
 Metro civTimeOut = Metro(100);						// civ read/write watchdog timer
 Metro aBandTimer = Metro(1000);						// autoband time milliseconds, auto reset
+Metro civPollTimer = Metro(IDLE_CIV_POLL);			// civ poll timer when idle
+Metro txPwrTimer = Metro(TX_PWR_POLL);				// radio power level refresh, see protectMain()
 #endif
 
 
@@ -118,17 +213,23 @@ enum frameNames {
 	peakPower,			// peak Pwr
 	vswr,				// VSWR frame
 	dBm ,				// dBm
+	retLoss,			// return loss
 	fwdPower,			// forward Pwr
 	refPower,			// reflected Pwr
 	fwdVolts,			// forward volts
 	refVolts,			// reflected volts
 	netPwrMeter,		// power meter
 	swrMeter,			// swr meter
+	pkAvgRatio,			// peak to average ratio
+	ccdfPwr,			// CCDF power
+	dutyCycle,			// transmit duty cycle
 	avgOptions,			// options button frame
 	samplesCalOpt,		// samples - calibrate
 	samplesDefOpt,		// samples - default
 	samplesAltOpt,		// samples - alternate
 	weighting,			// weighting for exp smoothing
+	stripPwr,			// options screen - net power
+	stripSwr,			// options screen - swr
 	freqTune,			// freqTune button frame
 	aBand,				// aqutoBand button frame
 	tuner,				// tuner
@@ -152,6 +253,7 @@ struct frame {
 	bool isOutLine;					// outline flg / don't display
 	bool isTouch;					// frame enabled for touch
 	bool isEnable;					// enable frame & CONTENTS
+	bool isHide;					// options screen open, frame enabled but not drawn
 };
 
 #ifdef CIV																	  
@@ -163,17 +265,23 @@ frame defFrame[] = {
 	{ 110, 5, 100, 65,		BG_COLOUR,	true,	true,	true},			// peak Pwr
 	{ 215, 5, 100, 65,		BG_COLOUR,	true,	true,	true},			// VSWR frame
 	{ 5, 5, 100, 85,		BG_COLOUR,	true,	false,	false},			// dBm
+	{ 215, 5, 100, 65,		BG_COLOUR,	true,	false,	false},			// return loss
 	{ 5, 115, 155, 30,		BG_COLOUR,	true,	false,	false},			// forward Pwr
 	{ 165, 115, 155, 30,	BG_COLOUR,	true,	false,	false},			// reflected Pwr
 	{ 5, 155, 155, 50,		BG_COLOUR,	true,	false,	false},			// forward volts
 	{ 165, 155, 155, 50,	BG_COLOUR,	true,	false,	false},			// reflected volts
 	{ 5, 95, 315, 50,		BG_COLOUR,	false,	true,	true},			// power meter
 	{ 5, 95, 315, 50,		BG_COLOUR,	false,	true,	false},			// swr meter
+	{ 5, 95, 100, 50,		BG_COLOUR,	true,	false,	false},			// peak to average ratio
+	{ 110, 95, 100, 50,		BG_COLOUR,	true,	false,	false},			// CCDF power
+	{ 215, 95, 100, 50,		BG_COLOUR,	true,	false,	false},			// transmit duty cycle
 	{ 215, 215, 100, 25,	BG_COLOUR,	true,	true,	true},			// options button frame
 	{ 215, 25, 75, 40,		BG_COLOUR,	true,	false,	false},			// samples - calibrate
 	{ 215, 70, 75, 40,		BG_COLOUR,	true,	false,	false},			// samples - default
 	{ 215, 115, 75, 40,		BG_COLOUR,	true,	false,	false},			// samples - alternate
 	{ 215, 160, 75, 40,		BG_COLOUR,	true,	false,	false},			// weighting for exp smoothing
+	{ 5, 210, 60, 28,		BG_COLOUR,	true,	false,	false},			// options screen - net power
+	{ 70, 210, 60, 28,		BG_COLOUR,	true,	false,	false},			// options screen - swr
 	{ 5, 215, 100, 25,		BG_COLOUR,	true,	true,	true},			// freqTune button frame
 	{ 110, 215,	100, 25,	BG_COLOUR,	true,	true,	true},			// aqutoBand button frame
 	{ 5, 160, 100, 50,		BG_COLOUR,	true,	true,	true},			// tuner
@@ -195,17 +303,23 @@ frame basicFrame[] = {
 	{ 110, 5, 100, 65,		BG_COLOUR,	true,	true,	true},			// peak Pwr
 	{ 215, 5, 100, 65,		BG_COLOUR,	true,	true,	true},			// VSWR frame
 	{ 5, 5, 100, 85,		BG_COLOUR,	true,	true,	false},			// dBm
+	{ 215, 5, 100, 65,		BG_COLOUR,	true,	false,	false},			// return loss
 	{ 5, 115,	155, 30,	BG_COLOUR,	true,	false,	false},			// forward Pwr
 	{ 165, 115, 155, 30,	BG_COLOUR,	true,	false,	false},			// reflected Pwr
 	{ 5, 155,	155, 50,	BG_COLOUR,	true,	false,	false},			// forward volts
 	{ 165, 155, 155, 50,	BG_COLOUR,	true,	false,	false},			// reflected volts
 	{ 5, 110,	315, 50,	BG_COLOUR,	false,	true,	true},			// power meter
 	{ 5, 160, 315, 50,		BG_COLOUR,	false,	true,	true},			// swr meter
+	{ 5, 110, 100, 50,		BG_COLOUR,	true,	false,	false},			// peak to average ratio
+	{ 110, 110, 100, 50,	BG_COLOUR,	true,	false,	false},			// CCDF power
+	{ 215, 110, 100, 50,	BG_COLOUR,	true,	false,	false},			// transmit duty cycle
 	{ 215, 215, 105, 25,	BG_COLOUR,	true,	true,	true},			// options button frame
 	{ 215, 25, 75, 40,		BG_COLOUR,	true,	false,	false},			// samples - calibrate
 	{ 215, 70, 75, 40,		BG_COLOUR,	true,	false,	false},			// samples - default
 	{ 215, 115, 75, 40,		BG_COLOUR,	true,	false,	false},			// samples - alternate
 	{ 215, 160, 75, 40,		BG_COLOUR,	true,	false,	false},			// weighting for exp smoothing
+	{ 5, 210, 60, 28,		BG_COLOUR,	true,	false,	false},			// options screen - net power
+	{ 70, 210, 60, 28,		BG_COLOUR,	true,	false,	false},			// options screen - swr
 };
 
 // calibration frames layout
@@ -216,23 +330,29 @@ frame calFrame[] = {
 	{ 110, 5, 100, 65,		BG_COLOUR,	true,	true,	true},			// peak Pwr
 	{ 215, 5, 100, 65,		BG_COLOUR,	true,	true,	true},			// VSWR frame
 	{ 5, 5, 100, 85,		BG_COLOUR,	true,	false,	false},			// dBm
+	{ 215, 5, 100, 65,		BG_COLOUR,	true,	false,	false},			// return loss
 	{ 5, 115, 155, 30,		BG_COLOUR,	true,	false,	true},			// forward Pwr
 	{ 165, 115, 155, 30,	BG_COLOUR,	true,	false,	true},			// reflected Pwr
 	{ 5, 155, 155, 50,		BG_COLOUR,	true,	false,	true},			// forward volts
 	{ 165, 155,155, 50,		BG_COLOUR,	true,	false,	true},			// reflected volts
 	{ 5, 95, 315, 55,		BG_COLOUR,	false,	false,	false},			// power meter
 	{ 5, 95, 315, 55,		BG_COLOUR,	false,	false,	false},			// swr meter
+	{ 5, 95, 100, 50,		BG_COLOUR,	true,	false,	false},			// peak to average ratio
+	{ 110, 95, 100, 50,		BG_COLOUR,	true,	false,	false},			// CCDF power
+	{ 215, 95, 100, 50,		BG_COLOUR,	true,	false,	false},			// transmit duty cycle
 	{ 215, 215,	105, 25,	BG_COLOUR,	true,	true,	true},			// options button frame
 	{ 215, 25, 75, 40,		BG_COLOUR,	true,	false,	false},			// samples - calibrate
 	{ 215, 70, 75, 40,		BG_COLOUR,	true,	false,	false},			// samples - default
 	{ 215, 115, 75, 40,		BG_COLOUR,	true,	false,	false},			// samples - alternate
 	{ 215, 160, 75, 40,		BG_COLOUR,	true,	false,	false},			// weighting for exp smoothing
+	{ 5, 210, 60, 28,		BG_COLOUR,	true,	false,	false},			// options screen - net power
+	{ 70, 210, 60, 28,		BG_COLOUR,	true,	false,	false},			// options screen - swr
 };
 
 #ifdef CIV
 #define MAX_FRAMES sizeof(defFrame)/sizeof(frame)
 #else
-#define MAX_FRAMES 16
+#define MAX_FRAMES 22
 #endif
 frame fr[MAX_FRAMES];					// working frame array - copy in defFrame, basicFrame or calFrame				
 
@@ -261,17 +381,23 @@ label lab[] = {
 	{ "Pep",		FG_COLOUR,		FONT14,		'C', 'B', false,	},		// peak Pwr
 	{ "vSWR",		FG_COLOUR,		FONT14,		'C', 'B', false,	},		// VSWR frame
 	{ "dBm",		FG_COLOUR,		FONT14,		'C', 'B', false,	},		// dBm
+	{ "RL dB",		FG_COLOUR,		FONT14,		'C', 'B', false,	},		// return loss
 	{ "Fwd Pwr",	YELLOW,			FONT10,		'L', 'M', false,	},		// forward Pwr
 	{ "Ref Pwr",	YELLOW,			FONT10,		'R', 'M', false,	},		// reflected Pwr
 	{ "Fwd Volts",	GREENYELLOW,	FONT10,		'R', 'M', false,	},		// forward volts
 	{ "Ref Volts",	GREENYELLOW,	FONT10,		'L', 'M', false,	},		// reflected volts
 	{ "       Watts",	FG_COLOUR,	FONT8,		'L', 'B', false,	},		// power meter
 	{ "       vSWR ",	FG_COLOUR,	FONT8,		'L', 'B', false,	},		// swr meter
+	{ "PAR dB",		FG_COLOUR,		FONT10,		'C', 'B', false,	},		// peak to average ratio
+	{ "",			FG_COLOUR,		FONT10,		'C', 'B', false,	},		// CCDF power, label from CCDF_LEVEL
+	{ "Duty %",		FG_COLOUR,		FONT10,		'C', 'B', false,	},		// transmit duty cycle
 	{ "Avg",		BUTTON_FG,		FONT12,		'C', 'M', false,	},		// options button frame
 	{ "",			CIV_COLOUR,		FONT14,		'L', 'M', false,	},		// samples - calibrate
 	{ "",			CIV_COLOUR,		FONT14,		'R', 'M', false,	},		// samples - default
 	{ "",			CIV_COLOUR,		FONT14,		'R', 'M', false,	},		// samples - alternate
 	{ "",			CIV_COLOUR,		FONT14,		'R', 'M', false,	},		// weighting for exp smoothing
+	{ "W",			FG_COLOUR,		FONT10,		'R', 'M', false,	},		// options screen - net power
+	{ "SWR",		FG_COLOUR,		FONT8,		'R', 'M', false,	},		// options screen - swr
 
 #ifdef CIV
 	{ "FreqTune On",BUTTON_FG,		FONT12,		'L', 'M', false,	},		// freqTune button frame
@@ -305,17 +431,23 @@ value val[] = {
 	{ 0.0,	0.0, 0,	"%1.0f",	FG_COLOUR,	FONT32,	    true},		// peak Pwr
 	{ 0.0,	0.0, 1,	"%3.1f",	ORANGE,		FONT28,	    true},		// VSWR frame
 	{ 0.0,	0.0, 0,	"%1.0f",	GREEN,		FONT40,	    true},		// dBm
+	{ 0.0,	0.0, 1,	"%3.1f",	GREEN,		FONT28,	    true},		// return loss
 	{ 0.0,	0.0, 3,	"%5.2f",	ORANGE,		FONT18,	    true},		// forward Pwr
 	{ 0.0,	0.0, 3,	"%5.2f",	ORANGE,		FONT18,	    true},		// reflected Pwr
 	{ 0.0,	0.0, 5,	"%3.5f",	ORANGE,		FONT20,	    true},		// forward volts
 	{ 0.0,	0.0, 5,	"%3.5f",	ORANGE,		FONT20,	    true},		// reflected volts
 	{ 0.0,	0.0, 0,	"%3.0f",	ORANGE,		FONT18,	    true},		// power meter
 	{ 0.0,	0.0, 0,	"%3.0f",	ORANGE,		FONT18,	    true},		// swr meter
+	{ 0.0,	0.0, 1,	"%3.1f",	GREEN,		FONT20,	    true},		// peak to average ratio
+	{ 0.0,	0.0, 1,	"%3.1f",	GREEN,		FONT20,	    true},		// CCDF power
+	{ 0.0,	0.0, 0,	"%3.0f",	GREEN,		FONT20,	    true},		// transmit duty cycle
 	{ 0.0,	0.0, 0,	"%3.0f",	BG_COLOUR,	FONT16,	    true},		// options button frame
 	{ 0.0,	0.0, 0,	"%3.0f",	CIV_COLOUR,	FONT18,	    true},		// samples - calibrate
 	{ 0.0,	0.0, 0,	"%3.0f",	CIV_COLOUR,	FONT18,	    true},		// samples - default
 	{ 0.0,	0.0, 0,	"%3.0f",	CIV_COLOUR,	FONT18,	    true},		// samples - alternate
 	{ 0.0,	0.0, 3,	"%3.3f",	CIV_COLOUR,	FONT18,	    true},		// weighting for exp smoothing
+	{ 0.0,	0.0, 0,	"%1.0f",	FG_COLOUR,	FONT16,	    true},		// options screen - net power
+	{ 0.0,	0.0, 1,	"%3.1f",	ORANGE,		FONT16,	    true},		// options screen - swr
 			
 #ifdef CIV	
 	{ 0.0,	0.0, 0,	"%3.0f",	BG_COLOUR,	FONT16,	    true},		// freqTune button frame
@@ -386,6 +518,26 @@ freqBand hfBand[] = {
 };
 #endif
 
+/* ADC sample, fwd and ref interleaved in one circular buffer - see getADC() */
+struct adcPair {
+	uint16_t fwd;					// forward ADC code
+	uint16_t ref;					// reflected ADC code
+};
+
+// board profile checks
+constexpr unsigned long sampleRam = BOARD_RAM / SAMPLE_RAM_SHARE;		// sample buffer RAM budget (bytes)
+static_assert((MAXBUF + 1) * sizeof(adcPair) <= sampleRam, "MAXBUF sample buffer over board RAM budget");
+static_assert(FAST_AVERAGING <= AVERAGING, "fast ADC profile averages more than low noise profile");
+
+/* envelope statistics - see getEnvStats() */
+struct envStat {
+	float par;						// peak to average ratio (dB)
+	float ccdf;						// power exceeded CCDF_LEVEL % of time, dB above average
+	float duty;						// transmit duty cycle (%)
+	float avgPwr;					// average keyed power (watts)
+	float pkPwr;					// peak power (watts)
+};
+
 /* structure for options boxes */
 struct optBox										// touch check bxes/circles co-ords
 {
@@ -394,6 +546,11 @@ struct optBox										// touch check bxes/circles co-ords
 };
 optBox		tb[30];									// tb[] is touch area co-ord
 
+/* options screens - see optViewOpen() */
+enum optViewNames { noView, avgView, tuneABandView, tuneTimeView };
+int			optView = noView;						// current options screen
+int			optTouchNum = 0;						// options screen last touch index, Exit
+
 /*----------EEPROM Options for HF Bands----------------------------------------------------*/
 // EEPROM Adresses + Increments
 #define		EEINCR 16								// address increment for band options and parameters
@@ -431,24 +588,3 @@ option     optWeight = { 500, 1, EEADDR_PARAM + 0x50 };			// weight (x1000) for
 option		optFreqTune = { 200,	0,	EEADDR_PARAM };			// freqTune parameters
 option		optABand = { 120,	0,	EEADDR_PARAM + 0x10 };		// autoband paramters
 #endif
-
-
-//
-//
-//#ifdef TEENSY40
-//#define		SAMPLE_INTERVAL 10									// ADC sample timer interval (microsecs)
-//#define     SAMPLES_CHANGE 500                                       // change samples amount
-//param		samplesSlowPar = { 5000, 1,	EEADDR_PARAM + 0x20 };		// number samples for averaging - default
-//param		samplesMedPar =	{ 2000,	1,	EEADDR_PARAM + 0x30 };		// alternate samples number
-//param		samplesFastPar = { 100,	1,	EEADDR_PARAM + 0x40 };		// samples for averaging
-//
-//#else                                                             // TEENSY32
-//#define		SAMPLE_INTERVAL 50									// ADC sample timer interval (microsecs)
-//#define     SAMPLES_CHANGE 20                                     // change samples amount
-//param		samplesSlowPar = { 500,	1,	EEADDR_PARAM + 0x20 };		// number samples for averaging - default
-//param		samplesMedPar = { 100, 1, EEADDR_PARAM + 0x30 };		// alternate samples number
-//param		samplesFastPar = { 1000,	1,	EEADDR_PARAM + 0x40 };	// samples for averaging
-//
-//#endif
-
-
@@ -8,16 +8,7 @@ Swr/PowerMeter + IC7300 C-IV Controller - https://github.com/GI8GZM/PowerMeter-C
 No publication without acknowledgement to author
 -------------------------------------------------------------------------------------*/
 
-//#ifdef TEENSY40
-//#define SAMPLE_INTERVAL 200						    // ADC sample timer interval (microsecs)
-//#define MAXBUF          10000						// maximum averaging buffer/samples size
-//
-//#else
-//#define SAMPLE_INTERVAL 400						    // ADC sample timer interval (microsecs)
-//#define MAXBUF          2000						// maximum averaging buffer/samples size
-//
-//#endif
-//
+// board profile, sample buffer size - see pwrMeter.h
 
 
 /*---------- Teensy pin assignments (use for wiring) --------------------------------------
@@ -41,7 +32,35 @@ board: referes to ILI9341 + Touch board   */
 #define	TEST_PIN        4							// high/low pulse output for timing
 
 /*----------ILI9341 TFT display (320x240)-------------------------*/
+#ifdef FRAME_BUFFER
+#ifndef TEENSY40
+#error FRAME_BUFFER needs Teensy 4.0 RAM, 2 x 320x240 x 16 bit buffers
+#endif
+DMAMEM uint16_t tftBuff[2][320 * 240];						// double buffer, one drawn while other sent
+
+// ILI9341_t3n with area drawn since last update, see updateDisplay()
+class ILI9341_fb : public ILI9341_t3n
+{
+public:
+	ILI9341_fb(uint8_t cs, uint8_t dc) : ILI9341_t3n(cs, dc) {}
+
+	// changed area, false if nothing drawn
+	bool changedArea(int* x, int* y, int* w, int* h)
+	{
+		if (_changed_min_x > _changed_max_x || _changed_min_y > _changed_max_y)
+			return false;
+		*x = _changed_min_x;
+		*y = _changed_min_y;
+		*w = _changed_max_x - _changed_min_x + 1;
+		*h = _changed_max_y - _changed_min_y + 1;
+		return true;
+	}
+	void clearChangedArea() { clearChangedRange(); }
+};
+ILI9341_fb	tft = ILI9341_fb(TFT_CS_PIN, TFT_DC_PIN);		// define tft device, frame buffer
+#else
 ILI9341_t3	tft = ILI9341_t3(TFT_CS_PIN, TFT_DC_PIN);		// define tft device
+#endif
 //ILI9341_t3(uint8_t _CS = 10, uint8_t _DC=9, uint8_t _RST = 255, uint8_t _MOSI = 11, uint8_t _SCLK = 13, uint8_t _MISO = 12);
 
 #define		TFT_FULL 255							// tft display full brightness
@@ -60,6 +60,9 @@ int chkTouchOption(int n, bool isRepeat)
 	TS_Point p;								// touch screen result structure
 	bool isTouch = false;
 
+	// frame buffer to tft, option changes
+	updateDisplay(false);
+
 	do
 	{
 		tStatus = touch();					// check for touch
@@ -160,16 +163,38 @@ void touchActions(int button, int tStat)				// touch actions for frame i, touch
 		dbmButton(tStat);
 		break;
 
-	case vswr:
-		swrButton(tStat);
+	case vswr:									// acknowledge swr trip, else swr button
+		if (isTrip)
+			protectAck();
+		else
+			swrButton(tStat);
+		break;
+
+	case retLoss:								// switch from return loss to swr
+		if (isTrip)
+			protectAck();
+		else
+			retLossButton(tStat);
+		break;
+
+	case netPwrMeter:							// swap with swrmeter, long touch for statistics
+		if (tStat == LONGTOUCH)
+			statsButton(netPwrMeter);
+		else
+			meterButton(netPwrMeter, swrMeter);
 		break;
 
-	case netPwrMeter:							// swap with swrmeter 
-		meterButton(netPwrMeter, swrMeter);
+	case swrMeter:								// swap with netPwrMeter, long touch for statistics
+		if (tStat == LONGTOUCH)
+			statsButton(swrMeter);
+		else
+			meterButton(swrMeter, netPwrMeter);
 		break;
 
-	case swrMeter:								// swap with netPwrMeter
-		meterButton(swrMeter, netPwrMeter);
+	case pkAvgRatio:							// envelope statistics, back to meter
+	case ccdfPwr:
+	case dutyCycle:
+		statsButton(button);
 		break;
 
 	case avgOptions:							// averaging options button